@@ -5,34 +5,93 @@
 #include <utility>
 #include <algorithm>
 #include <cassert>
+#include <cstdint>
+#include <new>
+#include <type_traits>
 
 #include "mini_allocator.h"
 #include "mini_functional.h"
 #include "mini_iterator.h"
+#include "mini_simd.h"
 #include "mini_type_traits.h"
 #include "mini_utility.h"
 
 namespace miniSTL
 {
-	// fill
-	// ʱ临ӶO(N)
-	template <typename ForwardIterator,typename T>
-	inline void fill(ForwardIterator first, ForwardIterator last, const T &value)
-	{
-		for (;first != last;++first) // 
-			*first = value;          // 趨ֵ
-	}
+	/*
+	* Ϊԭָ롢Ԫؿƽֵ T Ԫͬ߶ͣʱΪ _true_type
+	* ʱ fill ֵĸֽڶͬʱֱʹ memset
+	*/
+	template <typename Iterator,typename T>
+	struct _is_trivially_fillable
+	{
+		typedef typename std::remove_pointer<Iterator>::type value_type;
+		static const bool value = std::is_pointer<Iterator>::value && !std::is_const<value_type>::value &&
+			std::is_same<typename _type_traits<value_type>::has_trivial_assignment_operator, _true_type>::value &&
+			(std::is_same<value_type, T>::value || (std::is_arithmetic<value_type>::value && std::is_arithmetic<T>::value));
+		typedef typename FirstOrSecond<value, _true_type, _false_type>::result type;
+	};
 
-	template <>
-	inline void fill(char *first, char *last, const char &value)
+	namespace
 	{
-		memset(first, static_cast<unsigned char>(value), last - first);
+		//  value д [first,first+n)value ÿֽڶֽͬ͡0-1 ȣʱʹ memset
+		template <typename T>
+		T *_fill_trivial(T *first, size_t n, const T &value)
+		{
+			const unsigned char *bytes = reinterpret_cast<const unsigned char*>(&value);
+			size_t i = 1;
+			while (i < sizeof(T) && bytes[i] == bytes[0])
+				++i;
+			if (i == sizeof(T))
+			{
+				if (n != 0)
+					memset(first, bytes[0], n * sizeof(T));
+				return first + n;
+			}
+			for (;n > 0;--n, ++first)
+				*first = value;
+			return first;
+		}
+
+		template <typename ForwardIterator,typename T>
+		inline void _fill_aux(ForwardIterator first, ForwardIterator last, const T &value, _false_type)
+		{
+			for (;first != last;++first) // 
+				*first = value;          // 趨ֵ
+		}
+
+		template <typename Pointer,typename T>
+		inline void _fill_aux(Pointer first, Pointer last, const T &value, _true_type)
+		{
+			typedef typename std::remove_pointer<Pointer>::type value_type;
+			_fill_trivial(first, last - first, static_cast<value_type>(value));
+		}
+
+		template <typename OutputIterator,typename Size,typename T>
+		inline OutputIterator _fill_n_aux(OutputIterator first, Size n, const T &value, _false_type)
+		{
+			for (;n > 0;--n, ++first)
+				*first = value;
+			return first;
+		}
+
+		template <typename Pointer,typename Size,typename T>
+		inline Pointer _fill_n_aux(Pointer first, Size n, const T &value, _true_type)
+		{
+			typedef typename std::remove_pointer<Pointer>::type value_type;
+			if (n <= 0)
+				return first;
+			return _fill_trivial(first, static_cast<size_t>(n), static_cast<value_type>(value));
+		}
 	}
 
-	template <>
-	inline void fill(wchar_t *first, wchar_t *last, const char &value)
+	// fill
+	// ʱ临ӶO(N)
+	template <typename ForwardIterator,typename T>
+	inline void fill(ForwardIterator first, ForwardIterator last, const T &value)
 	{
-		memset(first, static_cast<unsigned char>(value), (last - first) * sizeof(wchar_t));
+		typedef typename _is_trivially_fillable<ForwardIterator, T>::type is_trivial;
+		_fill_aux(first, last, value, is_trivial());
 	}
 
 	/*
@@ -42,22 +101,8 @@ namespace miniSTL
 	template <typename OutputIterator,typename Size,typename T>
 	OutputIterator fill_n(OutputIterator first, Size n, const T &value)
 	{
-		for (;n > 0;--n, ++first)
-			*first = value;
-		return first;
-	}
-
-	template <typename Size>
-	char *fill_n(char *first, Size n, const char &value)
-	{
-		memset(first, static_cast<unsigned char>(value), n);
-		return first + n;
-	}
-
-	template <typename Size>
-	wchar_t *fill_n(wchar_t *first, Size n, const wchar_t &value)
-	{
-		memset(first, static_cast<unsigned char>(value), n * sizeof(wchar_t));
+		typedef typename _is_trivially_fillable<OutputIterator, T>::type is_trivial;
+		return _fill_n_aux(first, n, value, is_trivial());
 	}
 
 	/*
@@ -97,64 +142,198 @@ namespace miniSTL
 	* ʱ临Ӷ:O(N)
 	*/
 
-	// heap㷨
-	template <typename RandomAccessIterator,typename Compare>
-	static void up(RandomAccessIterator first, RandomAccessIterator last,
-		RandomAccessIterator head, Compare comp)
+	/*
+	* d ѣmake_dary_heap / push_dary_heap / pop_dary_heap / sort_dary_heap / is_dary_heap
+	*  D ڱڸ± i ӽڵΪ D*i+1 ~ D*i+DڵΪ (i-1)/D
+	* D ԽԽݸ졢³ʱÿȽϴ࣬ͬһӽڵڣͨͬһУ
+	* ѺܴԪغСʱ D = 4 ȶѿ
+	* ³ԵϣFloydķʽȰѿλؽϴӽڵһ·ƵҶӣٰԪشҶӴݣ
+	* ³ԪͨԶβҲڵײ㸽ÿֻӽڵ֮ȽϣʡȥıȽ
+	* ƶԪضǽÿֵֻһ
+	* make_heap ȶ㷨 D = 2 
+	*/
+	namespace
 	{
-		//Χ:[first,last]
-		if (first != last)
+		//  value ŵλ holeƶСĸڵ֮£ top
+		template <size_t D,typename RandomAccessIterator,typename Distance,typename T,typename Compare>
+		void _dary_sift_up(RandomAccessIterator first, Distance hole, Distance top, T value, Compare &comp)
 		{
-			auto index = last - head;
-			auto parent_index = (index - 1) / 2;
-			for (auto cur = last;parent_index >= 0 && cur != head;parent_index = (index - 1) / 2)
+			while (hole > top)
 			{
-				auto parent = head + parent_index;// ڵ
-				if (comp(*parent, *cur))
-					miniSTL::swap(*parent, *cur);
-				cur = parent;
-				index = cur - head;
+				Distance parent = (hole - 1) / D;
+				if (!comp(*(first + parent), value))
+					break;
+				*(first + hole) = std::move(*(first + parent));
+				hole = parent;
 			}
+			*(first + hole) = std::move(value);
 		}
-	}
 
-	template <typename RandomAccessIterator, typename Compare>
-	static void down(RandomAccessIterator first, RandomAccessIterator last,
-		RandomAccessIterator head, Compare comp)
-	{
-		if (first != last)
+		/*
+		*  child ʼ N ڽڵߵ±
+		* ȽϺٱȽʤߣȽ֮Ϊ log2(N)  N-1
+		* αȽϿͬʱУӽڵ֮ĴСϵģñȽϽѡ񣬱Ԥķ֧
+		*/
+		template <size_t N>
+		struct _dary_max_child
+		{
+			template <typename RandomAccessIterator,typename Distance,typename Compare>
+			static Distance select(RandomAccessIterator first, Distance child, Compare &comp)
+			{
+				Distance a = _dary_max_child<N / 2>::select(first, child, comp);
+				Distance b = _dary_max_child<N - N / 2>::select(first, child + static_cast<Distance>(N / 2), comp);
+				return a + static_cast<Distance>(comp(*(first + a), *(first + b))) * (b - a);
+			}
+		};
+
+		template <>
+		struct _dary_max_child<1>
+		{
+			template <typename RandomAccessIterator,typename Distance,typename Compare>
+			static Distance select(RandomAccessIterator, Distance child, Compare&)
+			{
+				return child;
+			}
+		};
+
+		//  [first,first+len) дӿλ hole ʼ³ value
+		template <size_t D,typename RandomAccessIterator,typename Distance,typename T,typename Compare>
+		void _dary_adjust_heap(RandomAccessIterator first, Distance hole, Distance len, T value, Compare &comp)
 		{
-			auto index = first - head;
-			auto left_child_index = index * 2 + 1;
-			for (auto cur = first;left_child_index < (last - head + 1) && cur < last;left_child_index = index * 2 + 1)
+			const Distance top = hole;
+			Distance child = D * hole + 1;
+			// ӽڵȫĲ
+			while (child + static_cast<Distance>(D) <= len)
+			{
+				// ѡ֮ǰԤȡڵ㣬 D*D Ԫأô뱾ıȽص
+				const Distance grandchild = D * child + 1;
+				if (grandchild < len)
+					simd::prefetch(&*(first + grandchild));
+				Distance best = _dary_max_child<D>::select(first, child, comp);
+				*(first + hole) = std::move(*(first + best));
+				hole = best;
+				child = D * hole + 1;
+			}
+			// һڲڵֻвӽڵ
+			if (child < len)
 			{
-				auto child = head + left_child_index;
-				if ((child + 1) <= last && *(child + 1) > *child)
-					child += 1;
-				if (comp(*cur, *child))
-					miniSTL::swap(*cur, *child);
-				cur = child;
-				index = cur - head;
+				Distance best = child;
+				for (Distance k = child + 1;k < len;++k)
+				{
+					if (comp(*(first + best), *(first + k)))
+						best = k;
+				}
+				*(first + hole) = std::move(*(first + best));
+				hole = best;
 			}
+			_dary_sift_up<D>(first, hole, top, std::move(value), comp);
 		}
 	}
 
-	template <typename RandomAccessIterator, typename Compare>
-	void make_heap(RandomAccessIterator first, RandomAccessIterator last, Compare comp)
+	template <size_t D,typename RandomAccessIterator,typename Compare>
+	void make_dary_heap(RandomAccessIterator first, RandomAccessIterator last, Compare comp)
+	{
+		static_assert(D >= 2, "heap arity must be at least 2");
+		const auto len = last - first;
+		if (len < 2)
+			return;
+		for (auto parent = (len - 2) / static_cast<decltype(len)>(D) + 1;parent-- != 0;)
+		{
+			auto value = std::move(*(first + parent));
+			_dary_adjust_heap<D>(first, parent, len, std::move(value), comp);
+		}
+	}
+
+	template <size_t D,typename RandomAccessIterator>
+	void make_dary_heap(RandomAccessIterator first, RandomAccessIterator last)
+	{
+		miniSTL::make_dary_heap<D>(first, last,
+			miniSTL::less<typename miniSTL::iterator_traits<RandomAccessIterator>::value_type>());
+	}
+
+	// [first,last-1) Ƕѣ *(last-1) 
+	template <size_t D,typename RandomAccessIterator,typename Compare>
+	void push_dary_heap(RandomAccessIterator first, RandomAccessIterator last, Compare comp)
+	{
+		static_assert(D >= 2, "heap arity must be at least 2");
+		const auto hole = last - first - 1;
+		if (hole <= 0)
+			return;
+		auto value = std::move(*(last - 1));
+		_dary_sift_up<D>(first, hole, decltype(hole)(0), std::move(value), comp);
+	}
+
+	template <size_t D,typename RandomAccessIterator>
+	void push_dary_heap(RandomAccessIterator first, RandomAccessIterator last)
+	{
+		miniSTL::push_dary_heap<D>(first, last,
+			miniSTL::less<typename miniSTL::iterator_traits<RandomAccessIterator>::value_type>());
+	}
+
+	// ѶѶƵ last-1[first,last-1) Ƕ
+	template <size_t D,typename RandomAccessIterator,typename Compare>
+	void pop_dary_heap(RandomAccessIterator first, RandomAccessIterator last, Compare comp)
+	{
+		static_assert(D >= 2, "heap arity must be at least 2");
+		const auto len = last - first - 1;
+		if (len <= 0)
+			return;
+		auto value = std::move(*(last - 1));
+		*(last - 1) = std::move(*first);
+		_dary_adjust_heap<D>(first, decltype(len)(0), len, std::move(value), comp);
+	}
+
+	template <size_t D,typename RandomAccessIterator>
+	void pop_dary_heap(RandomAccessIterator first, RandomAccessIterator last)
+	{
+		miniSTL::pop_dary_heap<D>(first, last,
+			miniSTL::less<typename miniSTL::iterator_traits<RandomAccessIterator>::value_type>());
+	}
+
+	template <size_t D,typename RandomAccessIterator,typename Compare>
+	void sort_dary_heap(RandomAccessIterator first, RandomAccessIterator last, Compare comp)
+	{
+		for (;last - first > 1;--last)
+			miniSTL::pop_dary_heap<D>(first, last, comp);
+	}
+
+	template <size_t D,typename RandomAccessIterator>
+	void sort_dary_heap(RandomAccessIterator first, RandomAccessIterator last)
+	{
+		miniSTL::sort_dary_heap<D>(first, last,
+			miniSTL::less<typename miniSTL::iterator_traits<RandomAccessIterator>::value_type>());
+	}
+
+	template <size_t D,typename RandomAccessIterator,typename Compare>
+	bool is_dary_heap(RandomAccessIterator first, RandomAccessIterator last, Compare comp)
 	{
-		const auto range = last - first;
-		for (auto cur = first + range / 2 - 1;cur >= first;--cur)
+		static_assert(D >= 2, "heap arity must be at least 2");
+		const auto len = last - first;
+		for (decltype(last - first) i = 1;i < len;++i)
 		{
-			miniSTL::down(cur, last - 1, first, comp);
-			if (cur == first)
-				return;
+			if (comp(*(first + (i - 1) / static_cast<decltype(len)>(D)), *(first + i)))
+				return false;
 		}
+		return true;
+	}
+
+	template <size_t D,typename RandomAccessIterator>
+	bool is_dary_heap(RandomAccessIterator first, RandomAccessIterator last)
+	{
+		return miniSTL::is_dary_heap<D>(first, last,
+			miniSTL::less<typename miniSTL::iterator_traits<RandomAccessIterator>::value_type>());
+	}
+
+	template <typename RandomAccessIterator, typename Compare>
+	void make_heap(RandomAccessIterator first, RandomAccessIterator last, Compare comp)
+	{
+		miniSTL::make_dary_heap<2>(first, last, comp);
 	}
 
 	template <typename RandomAccessIterator>
 	void make_heap(RandomAccessIterator first, RandomAccessIterator last)
 	{
-		make_heap(first, last,
+		miniSTL::make_heap(first, last,
 			miniSTL::less< typename miniSTL::iterator_traits<RandomAccessIterator>::value_type>());
 	}
 
@@ -165,7 +344,7 @@ namespace miniSTL
 	template <typename RandomAccessIterator,typename Compare>
 	void push_heap(RandomAccessIterator first, RandomAccessIterator last, Compare comp)
 	{
-		miniSTL::up(first, last - 1, first, comp);
+		miniSTL::push_dary_heap<2>(first, last, comp);
 	}
 
 	template <typename RandomAccessIterator>
@@ -182,9 +361,7 @@ namespace miniSTL
 	template <typename RandomAccessIterator,typename Compare>
 	void pop_heap(RandomAccessIterator first, RandomAccessIterator last, Compare comp)
 	{
-		miniSTL::swap(*first, *(last - 1));
-		if (last - first >= 2)
-			miniSTL::down(first, last - 2, first, comp);
+		miniSTL::pop_dary_heap<2>(first, last, comp);
 	}
 
 	template <typename RandomAccessIterator>
@@ -195,13 +372,12 @@ namespace miniSTL
 
 	/*
 	* Sort_heap
-	* O(N)
+	* O(NlgN)
 	*/
 	template <typename RandomAccessIterator,typename Compare>
 	void sort_heap(RandomAccessIterator first, RandomAccessIterator last, Compare comp)
 	{
-		for (auto cur = last;cur != first;--cur)
-			miniSTL::pop_heap(first, cur, comp);
+		miniSTL::sort_dary_heap<2>(first, last, comp);
 	}
 
 	template <typename RandomAccessIterator>
@@ -218,19 +394,7 @@ namespace miniSTL
 	template <typename RandomAccessIterator,typename Compare>
 	bool is_heap(RandomAccessIterator first, RandomAccessIterator last, Compare comp)
 	{
-		const auto range = last - first;
-		auto index = range / 2 - 1;
-		for (auto cur = first + range / 2 - 1;cur >= first;--cur,--index)
-		{
-			if (*(first + (index * 2 + 1)) > *cur || // ڵ
-				((first + (index * 2 + 2)) <= last && *(first + (index * 2 + 2)) > *cur))//ҽڵ
-			{
-				return false;
-			}
-			if (cur == first)
-				break;
-		}
-		return true;
+		return miniSTL::is_dary_heap<2>(first, last, comp);
 	}
 
 	template <typename RandomAccessIterator>
@@ -299,19 +463,127 @@ namespace miniSTL
 		return fn;
 	}
 
+	/*
+	* transform()
+	* O(N)
+	*  op  [first,last) ÿԪأӦλõԪأд result
+	*/
+	template <typename InputIterator,typename OutputIterator,typename UnaryOperation>
+	OutputIterator transform(InputIterator first, InputIterator last,
+		OutputIterator result, UnaryOperation op)
+	{
+		for (;first != last;++first, ++result)
+			*result = op(*first);
+		return result;
+	}
+
+	template <typename InputIterator1,typename InputIterator2,typename OutputIterator,typename BinaryOperation>
+	OutputIterator transform(InputIterator1 first1, InputIterator1 last1,
+		InputIterator2 first2, OutputIterator result, BinaryOperation op)
+	{
+		for (;first1 != last1;++first1, ++first2, ++result)
+			*result = op(*first1, *first2);
+		return result;
+	}
+
+	/*
+	* Ϊָԭָ롢ҪҵֵҲʱΪ _true_type
+	* ʱ find  count ԰Ԫصͬȵ޷ SIMD λȽ
+	* bool  operator== ȰΪ intλȽ֮ȼۣų
+	*  +0.0 == -0.0  NaN != NaNͬܰλȽ
+	*/
+	template <typename Iterator,typename T>
+	struct _is_simd_searchable
+	{
+		typedef typename std::remove_cv<typename std::remove_pointer<Iterator>::type>::type value_type;
+		static const bool value = std::is_pointer<Iterator>::value && std::is_integral<value_type>::value &&
+			!std::is_same<value_type, bool>::value && std::is_integral<T>::value && !std::is_same<T, bool>::value &&
+			(sizeof(value_type) == 1 || sizeof(value_type) == 2 || sizeof(value_type) == 4 || sizeof(value_type) == 8);
+		typedef typename FirstOrSecond<value, _true_type, _false_type>::result type;
+	};
+
+	namespace
+	{
+		template <size_t Bytes>
+		struct _unsigned_of_size;
+
+		template <> struct _unsigned_of_size<1> { typedef uint8_t type; };
+		template <> struct _unsigned_of_size<2> { typedef uint16_t type; };
+		template <> struct _unsigned_of_size<4> { typedef uint32_t type; };
+		template <> struct _unsigned_of_size<8> { typedef uint64_t type; };
+
+		/*
+		*  val תΪԪͣval ޷Ԫͱʾʱ false
+		* ʱκԪض val ȣԪ val ȵҽ߰λ
+		*/
+		template <typename ValueType,typename T>
+		bool _to_element_bits(const T &val, typename _unsigned_of_size<sizeof(ValueType)>::type &bits)
+		{
+			ValueType v = static_cast<ValueType>(val);
+			if (static_cast<T>(v) != val)
+				return false;
+			memcpy(&bits, &v, sizeof(v));
+			return true;
+		}
+
+		template <typename InputIterator,typename T>
+		InputIterator _find_aux(InputIterator first, InputIterator last, const T &val, _false_type)
+		{
+			for (;first != last;++first)
+			{
+				if (*first == val)
+					break;
+			}
+			return first;
+		}
+
+		template <typename Pointer,typename T>
+		Pointer _find_aux(Pointer first, Pointer last, const T &val, _true_type)
+		{
+			typedef typename std::remove_cv<typename std::remove_pointer<Pointer>::type>::type value_type;
+			typedef typename _unsigned_of_size<sizeof(value_type)>::type bits_type;
+			bits_type bits;
+			if (!_to_element_bits<value_type>(val, bits))
+				return last;
+			return first + simd::find_value(reinterpret_cast<const bits_type*>(first), last - first, bits);
+		}
+
+		template <typename InputIterator,typename T>
+		typename iterator_traits<InputIterator>::difference_type
+			_count_aux(InputIterator first, InputIterator last, const T &val, _false_type)
+		{
+			typename iterator_traits<InputIterator>::difference_type n = 0;
+			for (;first != last;++first)
+			{
+				if (*first == val)
+					++n;
+			}
+			return n;
+		}
+
+		template <typename Pointer,typename T>
+		typename iterator_traits<Pointer>::difference_type
+			_count_aux(Pointer first, Pointer last, const T &val, _true_type)
+		{
+			typedef typename std::remove_cv<typename std::remove_pointer<Pointer>::type>::type value_type;
+			typedef typename _unsigned_of_size<sizeof(value_type)>::type bits_type;
+			bits_type bits;
+			if (!_to_element_bits<value_type>(val, bits))
+				return 0;
+			return simd::count_value(reinterpret_cast<const bits_type*>(first), last - first, bits);
+		}
+	}
+
 	/*
 	* find()
 	* O(N)
+	* ԭָָʱ SIMD ȽϣֽԪʹ memchr
 	*/
 	template <typename InputIterator,typename T>
 	InputIterator find(InputIterator first, InputIterator last, const T &val)
 	{
-		for (;first != last;++first)
-		{
-			if (*first == val)
-				break;
-		}
-		return first;
+		typedef typename _is_simd_searchable<InputIterator, T>::type is_simd;
+		return _find_aux(first, last, val, is_simd());
 	}
 
 	/*
@@ -466,10 +738,23 @@ namespace miniSTL
 	/*
 	* Count
 	* O(N)
+	*  find ͬԭָָʱ SIMD Ƚ
 	*/
 	template <typename InputIterator,typename T>
 	typename iterator_traits<InputIterator>::difference_type
 		count(InputIterator first, InputIterator last, const T &val)
+	{
+		typedef typename _is_simd_searchable<InputIterator, T>::type is_simd;
+		return _count_aux(first, last, val, is_simd());
+	}
+
+	/*
+	* count_if
+	* O(N)
+	*/
+	template <typename InputIterator,typename UnaryPredicate>
+	typename iterator_traits<InputIterator>::difference_type
+		count_if(InputIterator first, InputIterator last, UnaryPredicate pred)
 	{
 		typename iterator_traits<InputIterator>::difference_type n = 0;
 		for (;first != last;++first)
@@ -481,103 +766,311 @@ namespace miniSTL
 	}
 
 	/*
-	* mismatch
+	* reduce
 	* O(N)
+	*  accumulate ͬ˳ϣop Ӧ뽻ɣ
+	* а汾Ľ봮а汾һ
 	*/
-	template <typename InputIterator1,typename InputIterator2>
-	pair<InputIterator1,InputIterator2>
-		mismatch(InputIterator1 first1, InputIterator1 last1,
-			InputIterator2 first2)
+	template <typename InputIterator,typename T,typename BinaryOperation>
+	T reduce(InputIterator first, InputIterator last, T init, BinaryOperation op)
 	{
-		for (;first1 != last1;++first1, ++first2)
-		{
-			if (*first1 != *first2)
-				break;
-		}
-		return miniSTL::make_pair(first1, first2);
+		for (;first != last;++first)
+			init = op(init, *first);
+		return init;
 	}
 
-	template <typename InputIterator1,typename InputIterator2,typename BinaryPredicate>
-	pair<InputIterator1,InputIterator2>
-		mismatch(InputIterator1 first1, InputIterator1 last1,
-			InputIterator2 first2, BinaryPredicate pred)
+	template <typename InputIterator,typename T>
+	T reduce(InputIterator first, InputIterator last, T init)
 	{
-		for (;first1 != last1;++first1, ++first2)
-		{
-			if (!pred(*first1, *first2))
-				break;
-		}
-		return miniSTL::make_pair(first1, first2);
+		return miniSTL::reduce(first, last, init, plus<T>());
+	}
+
+	template <typename InputIterator>
+	typename iterator_traits<InputIterator>::value_type
+		reduce(InputIterator first, InputIterator last)
+	{
+		typedef typename iterator_traits<InputIterator>::value_type value_type;
+		return miniSTL::reduce(first, last, value_type(), plus<value_type>());
 	}
 
 	/*
-	* equal
+	* transform_reduce
 	* O(N)
+	*  transform_op 任ÿԪأӦλõԪأ reduce_op Լ
+	* İ汾ڻ
 	*/
-	template <typename InputIterator1,typename InputIterator2,typename BinaryPredicate>
-	bool equal(InputIterator1 first1, InputIterator1 last1,
-		InputIterator2 first2, BinaryPredicate pred)
+	template <typename InputIterator1,typename InputIterator2,typename T,
+		typename BinaryReduceOperation,typename BinaryTransformOperation>
+	T transform_reduce(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2, T init,
+		BinaryReduceOperation reduce_op, BinaryTransformOperation transform_op)
 	{
 		for (;first1 != last1;++first1, ++first2)
+			init = reduce_op(init, transform_op(*first1, *first2));
+		return init;
+	}
+
+	template <typename InputIterator1,typename InputIterator2,typename T>
+	T transform_reduce(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2, T init)
+	{
+		return miniSTL::transform_reduce(first1, last1, first2, init, plus<T>(), multiplies<T>());
+	}
+
+	template <typename InputIterator,typename T,typename BinaryReduceOperation,typename UnaryTransformOperation>
+	T transform_reduce(InputIterator first, InputIterator last, T init,
+		BinaryReduceOperation reduce_op, UnaryTransformOperation transform_op)
+	{
+		for (;first != last;++first)
+			init = reduce_op(init, transform_op(*first));
+		return init;
+	}
+
+	/*
+	* inclusive_scan
+	* O(N)
+	* result ĵ i ԪΪ initУǰ i+1 Ԫصۻresult Ե first
+	*/
+	template <typename InputIterator,typename OutputIterator,typename BinaryOperation,typename T>
+	OutputIterator inclusive_scan(InputIterator first, InputIterator last,
+		OutputIterator result, BinaryOperation op, T init)
+	{
+		for (;first != last;++first, ++result)
 		{
-			if (!pred(*first1, *first2))
-				return false;
+			init = op(init, *first);
+			*result = init;
 		}
-		return true;
+		return result;
 	}
 
+	template <typename InputIterator,typename OutputIterator,typename BinaryOperation>
+	OutputIterator inclusive_scan(InputIterator first, InputIterator last,
+		OutputIterator result, BinaryOperation op)
+	{
+		if (first == last)
+			return result;
+		typename iterator_traits<InputIterator>::value_type acc = *first;
+		*result = acc;
+		return miniSTL::inclusive_scan(++first, last, ++result, op, acc);
+	}
 
-	template <typename InputIterator1,typename InputIterator2>
-	bool equal(InputIterator1 first1, InputIterator1 last1,
-		InputIterator2 first2)
+	template <typename InputIterator,typename OutputIterator>
+	OutputIterator inclusive_scan(InputIterator first, InputIterator last, OutputIterator result)
 	{
-		return miniSTL::equal(first1, last1, first2,
-			miniSTL::equal_to<typename miniSTL::iterator_traits<InputIterator1>::value_type>());
+		return miniSTL::inclusive_scan(first, last, result,
+			plus<typename iterator_traits<InputIterator>::value_type>());
 	}
 
 	/*
-	* is_permutation
-	* O(N*N)
+	* exclusive_scan
+	* O(N)
+	* result ĵ i ԪΪ init ǰ i Ԫصۻresult Ե first
 	*/
-	template <typename ForwardIterator1,typename ForwardIterator2,typename BinaryPredicate>
-	bool is_permutation(ForwardIterator1 first1, ForwardIterator1 last1,
-		ForwardIterator2 first2, BinaryPredicate pred)
+	template <typename InputIterator,typename OutputIterator,typename T,typename BinaryOperation>
+	OutputIterator exclusive_scan(InputIterator first, InputIterator last,
+		OutputIterator result, T init, BinaryOperation op)
 	{
-		// Ѱһȵλ
-		auto res = miniSTL::mismatch(first1, last1, first2, pred);
-		first1 = res.first, first2 = res.senond;
-		if (first1 == last1)
-			return true;
-		auto last2 = first2;
-		std::advance(last2, std::distance(first1, last1));
-		for (auto it1 = first1;it1 != last1;++it1)
+		for (;first != last;++first, ++result)
 		{
-			if (miniSTL::find_if(first1, it1, [&](decltype(*first1) val) {return pred(val, *it1);}) == it1)
-			{
-				auto n = miniSTL::count(first2, last2, *it1);
-				if (n == 0 || miniSTL::count(it1, last1, *it1))
-					return false;
-			}
+			// ȶдresult  first ͬʱҲȷ
+			T next = op(init, *first);
+			*result = init;
+			init = next;
 		}
-		return true;
+		return result;
+	}
+
+	template <typename InputIterator,typename OutputIterator,typename T>
+	OutputIterator exclusive_scan(InputIterator first, InputIterator last,
+		OutputIterator result, T init)
+	{
+		return miniSTL::exclusive_scan(first, last, result, init, plus<T>());
 	}
 
 	/*
-	* search
-	* O(N*N)
+	* ָͬһֽֿڱȽ͵ԭָʱΪ _true_type
+	* ʱ԰䵱ֽн SIMD 
 	*/
-	template <typename ForwardIterator1,typename ForwardIterator2,typename BinaryPredicate>
-	ForwardIterator1 search(ForwardIterator1 first1, ForwardIterator1 last1,
-		ForwardIterator2 first2, ForwardIterator2 last2,
-		BinaryPredicate pred)
+	template <typename Iterator1,typename Iterator2>
+	struct _is_bitwise_comparable_pointers
+	{
+		typedef typename std::remove_cv<typename std::remove_pointer<Iterator1>::type>::type value_type1;
+		typedef typename std::remove_cv<typename std::remove_pointer<Iterator2>::type>::type value_type2;
+		static const bool value = std::is_pointer<Iterator1>::value && std::is_pointer<Iterator2>::value &&
+			std::is_same<value_type1, value_type2>::value && _is_bitwise_comparable<value_type1>::value;
+		typedef typename FirstOrSecond<value, _true_type, _false_type>::result type;
+	};
+
+	namespace
 	{
-		while (first1 != last1)
+		template <typename InputIterator1,typename InputIterator2>
+		pair<InputIterator1,InputIterator2>
+			_mismatch_aux(InputIterator1 first1, InputIterator1 last1,
+				InputIterator2 first2, _false_type)
 		{
-			auto it1 = first1;
-			auto it2 = first2;
-			while (it1 != last1 && it2 != last2)
+			for (;first1 != last1;++first1, ++first2)
 			{
-				if (pred(*it1, *it2))
+				if (*first1 != *first2)
+					break;
+			}
+			return miniSTL::make_pair(first1, first2);
+		}
+
+		template <typename Pointer1,typename Pointer2>
+		pair<Pointer1,Pointer2>
+			_mismatch_aux(Pointer1 first1, Pointer1 last1, Pointer2 first2, _true_type)
+		{
+			typedef typename std::remove_pointer<Pointer1>::type value_type;
+			size_t n = last1 - first1;
+			size_t i = simd::mismatch_bytes(first1, first2, n * sizeof(value_type)) / sizeof(value_type);
+			return miniSTL::make_pair(first1 + i, first2 + i);
+		}
+
+		template <typename InputIterator1,typename InputIterator2>
+		bool _equal_aux(InputIterator1 first1, InputIterator1 last1,
+			InputIterator2 first2, _false_type)
+		{
+			for (;first1 != last1;++first1, ++first2)
+			{
+				if (!(*first1 == *first2))
+					return false;
+			}
+			return true;
+		}
+
+		template <typename Pointer1,typename Pointer2>
+		bool _equal_aux(Pointer1 first1, Pointer1 last1, Pointer2 first2, _true_type)
+		{
+			typedef typename std::remove_pointer<Pointer1>::type value_type;
+			size_t n = last1 - first1;
+			return n == 0 || memcmp(first1, first2, n * sizeof(value_type)) == 0;
+		}
+	}
+
+	/*
+	* mismatch
+	* O(N)
+	* ߶ָͬһöٻָ͵ԭָʱ SIMD ֽڱȽ
+	*/
+	template <typename InputIterator1,typename InputIterator2>
+	pair<InputIterator1,InputIterator2>
+		mismatch(InputIterator1 first1, InputIterator1 last1,
+			InputIterator2 first2)
+	{
+		typedef typename _is_bitwise_comparable_pointers<InputIterator1, InputIterator2>::type is_bitwise;
+		return _mismatch_aux(first1, last1, first2, is_bitwise());
+	}
+
+	template <typename InputIterator1,typename InputIterator2,typename BinaryPredicate>
+	pair<InputIterator1,InputIterator2>
+		mismatch(InputIterator1 first1, InputIterator1 last1,
+			InputIterator2 first2, BinaryPredicate pred)
+	{
+		for (;first1 != last1;++first1, ++first2)
+		{
+			if (!pred(*first1, *first2))
+				break;
+		}
+		return miniSTL::make_pair(first1, first2);
+	}
+
+	/*
+	* equal
+	* O(N)
+	*/
+	template <typename InputIterator1,typename InputIterator2,typename BinaryPredicate>
+	bool equal(InputIterator1 first1, InputIterator1 last1,
+		InputIterator2 first2, BinaryPredicate pred)
+	{
+		for (;first1 != last1;++first1, ++first2)
+		{
+			if (!pred(*first1, *first2))
+				return false;
+		}
+		return true;
+	}
+
+
+	// ߶ָͬһöٻָ͵ԭָʱֱʹ memcmp
+	template <typename InputIterator1,typename InputIterator2>
+	bool equal(InputIterator1 first1, InputIterator1 last1,
+		InputIterator2 first2)
+	{
+		typedef typename _is_bitwise_comparable_pointers<InputIterator1, InputIterator2>::type is_bitwise;
+		return _equal_aux(first1, last1, first2, is_bitwise());
+	}
+
+	/*
+	* lexicographical_compare
+	* O(N)
+	*/
+	template <typename InputIterator1,typename InputIterator2,typename Compare>
+	bool lexicographical_compare(InputIterator1 first1, InputIterator1 last1,
+		InputIterator2 first2, InputIterator2 last2, Compare comp)
+	{
+		for (;first1 != last1 && first2 != last2;++first1, ++first2)
+		{
+			if (comp(*first1, *first2))
+				return true;
+			if (comp(*first2, *first1))
+				return false;
+		}
+		return first1 == last1 && first2 != last2;
+	}
+
+	namespace
+	{
+		template <typename InputIterator1,typename InputIterator2>
+		bool _lexicographical_compare_aux(InputIterator1 first1, InputIterator1 last1,
+			InputIterator2 first2, InputIterator2 last2, _false_type)
+		{
+			for (;first1 != last1 && first2 != last2;++first1, ++first2)
+			{
+				if (*first1 < *first2)
+					return true;
+				if (*first2 < *first1)
+					return false;
+			}
+			return first1 == last1 && first2 != last2;
+		}
+
+		//  SIMD ֽҵһȵԪأֻԸԪһαȽ
+		template <typename Pointer1,typename Pointer2>
+		bool _lexicographical_compare_aux(Pointer1 first1, Pointer1 last1,
+			Pointer2 first2, Pointer2 last2, _true_type)
+		{
+			typedef typename std::remove_pointer<Pointer1>::type value_type;
+			size_t len1 = last1 - first1, len2 = last2 - first2;
+			size_t n = len1 < len2 ? len1 : len2;
+			size_t i = simd::mismatch_bytes(first1, first2, n * sizeof(value_type)) / sizeof(value_type);
+			if (i != n)
+				return first1[i] < first2[i];
+			return len1 < len2;
+		}
+	}
+
+	template <typename InputIterator1,typename InputIterator2>
+	bool lexicographical_compare(InputIterator1 first1, InputIterator1 last1,
+		InputIterator2 first2, InputIterator2 last2)
+	{
+		typedef typename _is_bitwise_comparable_pointers<InputIterator1, InputIterator2>::type is_bitwise;
+		return _lexicographical_compare_aux(first1, last1, first2, last2, is_bitwise());
+	}
+
+	/*
+	* search
+	* O(N*N)
+	*/
+	template <typename ForwardIterator1,typename ForwardIterator2,typename BinaryPredicate>
+	ForwardIterator1 search(ForwardIterator1 first1, ForwardIterator1 last1,
+		ForwardIterator2 first2, ForwardIterator2 last2,
+		BinaryPredicate pred)
+	{
+		while (first1 != last1)
+		{
+			auto it1 = first1;
+			auto it2 = first2;
+			while (it1 != last1 && it2 != last2)
+			{
+				if (pred(*it1, *it2))
 				{
 					++it1;
 					++it2;
@@ -594,211 +1087,2134 @@ namespace miniSTL
 		return last1;
 	}
 
-	template <typename ForwardIterator1,typename ForwardIterator2>
-	ForwardIterator1 search(ForwardIterator1 first1, ForwardIterator1 last1,
-		ForwardIterator2 first2, ForwardIterator2 last2)
+	template <typename ForwardIterator1,typename ForwardIterator2>
+	ForwardIterator1 search(ForwardIterator1 first1, ForwardIterator1 last1,
+		ForwardIterator2 first2, ForwardIterator2 last2)
+	{
+		return miniSTL::search(first1, first2, first2, last2,
+			miniSTL::equal_to<typename miniSTL::iterator_traits<ForwardIterator1>::value_type>());
+	}
+
+	/*
+	* advance
+	* O(N)
+	*/
+	namespace
+	{
+		template <typename InputIterator,typename Distance>
+		void _advance(InputIterator &it, Distance n, input_iterator_tag)
+		{
+			assert(n >= 0);
+			while (n--)
+			{
+				++it;
+			}
+		}
+
+		template <typename BidirectionalIterator,typename Distance>
+		void _advance(BidirectionalIterator &it, Distance n, bidirectional_iterator_tag)
+		{
+			if (n < 0)
+			{
+				while (n++)
+				{
+					--it;
+				}
+			}
+			else
+			{
+				while (n--)
+				{
+					++it;
+				}
+			}
+		}
+
+		template <typename RandomIterator,typename Distance>
+		void _advance(RandomIterator &it, Distance n, random_access_iterator_tag)
+		{
+			if (n < 0)
+			{
+				it -= (-n);
+			}
+			else
+			{
+				it += n;
+			}
+		}
+	}
+
+	template <typename InputIterator,typename Distance>
+	void advance(InputIterator &it, Distance n)
+	{
+		typedef iterator_traits<InputIterator>::iterator_category iterator_category;
+		_advance(it, n, iterator_category());
+	}
+
+	/*
+	* sort
+	* O(NlogN)
+	* ʡintrosort
+	*   ԿΪݹȳ 2*log2(N) ʱö򣬱֤ O(NlogN)
+	*   䳤Ȳ INSERTION_SORT_THRESHOLD ʱĲ
+	*  pdqsort ˼Ĵ
+	*   һλûзʱ޲ĲѾֻ O(N)
+	*   һʱѵԪһԹ鵽ߣظԪʱ˻
+	*   ּƽʱҼԪأƻ˻ģʽ
+	*/
+	namespace
+	{
+		enum { INSERTION_SORT_THRESHOLD = 24, NINTHER_THRESHOLD = 128, PARTIAL_INSERTION_SORT_LIMIT = 8 };
+
+		template <typename RandomIterator,typename BinaryPredicate>
+		inline void sort2(RandomIterator a, RandomIterator b, BinaryPredicate pred)
+		{
+			if (pred(*b, *a))
+				swap(*a, *b);
+		}
+
+		//  *a <= *b <= *c
+		template <typename RandomIterator,typename BinaryPredicate>
+		inline void sort3(RandomIterator a, RandomIterator b, RandomIterator c, BinaryPredicate pred)
+		{
+			sort2(a, b, pred);
+			sort2(b, c, pred);
+			sort2(a, b, pred);
+		}
+
+		// ŵ *first֤ڴڲںͲСԪΪڱ
+		template <typename RandomIterator,typename BinaryPredicate>
+		void choose_pivot(RandomIterator first, RandomIterator last, BinaryPredicate pred)
+		{
+			auto len = last - first;
+			auto half = len / 2;
+			if (len > NINTHER_THRESHOLD)
+			{
+				// ŵȡУninther
+				sort3(first, first + half, last - 1, pred);
+				sort3(first + 1, first + (half - 1), last - 2, pred);
+				sort3(first + 2, first + (half + 1), last - 3, pred);
+				sort3(first + (half - 1), first + half, first + (half + 1), pred);
+				swap(*first, *(first + half));
+			}
+			else
+			{
+				sort3(first + half, first, last - 1, pred);
+			}
+		}
+
+		template <typename RandomIterator,typename BinaryPredicate>
+		void insertion_sort(RandomIterator first, RandomIterator last, BinaryPredicate pred)
+		{
+			if (first == last)
+				return;
+			for (auto cur = first + 1;cur != last;++cur)
+			{
+				if (pred(*cur, *(cur - 1)))
+				{
+					auto tmp = std::move(*cur);
+					auto sift = cur;
+					do
+					{
+						*sift = std::move(*(sift - 1));
+						--sift;
+					} while (sift != first && pred(tmp, *(sift - 1)));
+					*sift = std::move(tmp);
+				}
+			}
+		}
+
+		// ֤߱ *(first-1) κԪأڲѭ˲ؼ߽
+		template <typename RandomIterator,typename BinaryPredicate>
+		void unguarded_insertion_sort(RandomIterator first, RandomIterator last, BinaryPredicate pred)
+		{
+			if (first == last)
+				return;
+			for (auto cur = first + 1;cur != last;++cur)
+			{
+				if (pred(*cur, *(cur - 1)))
+				{
+					auto tmp = std::move(*cur);
+					auto sift = cur;
+					do
+					{
+						*sift = std::move(*(sift - 1));
+						--sift;
+					} while (pred(tmp, *(sift - 1)));
+					*sift = std::move(tmp);
+				}
+			}
+		}
+
+		// ƶ PARTIAL_INSERTION_SORT_LIMIT ͷ falseʱѲԺϷ
+		template <typename RandomIterator,typename BinaryPredicate>
+		bool partial_insertion_sort(RandomIterator first, RandomIterator last, BinaryPredicate pred)
+		{
+			if (first == last)
+				return true;
+			size_t moved = 0;
+			for (auto cur = first + 1;cur != last;++cur)
+			{
+				if (pred(*cur, *(cur - 1)))
+				{
+					auto tmp = std::move(*cur);
+					auto sift = cur;
+					do
+					{
+						*sift = std::move(*(sift - 1));
+						--sift;
+					} while (sift != first && pred(tmp, *(sift - 1)));
+					*sift = std::move(tmp);
+					moved += cur - sift;
+				}
+				if (moved > PARTIAL_INSERTION_SORT_LIMIT)
+					return false;
+			}
+			return true;
+		}
+
+		/*
+		*  *first ΪỮ֣СķߣСڵķұߣλ
+		* ڻֹһֱ *firstֻ (first,last) 
+		* already_partitioned ʾǰѾǻֺõ
+		*/
+		template <typename RandomIterator,typename BinaryPredicate>
+		RandomIterator partition_right(RandomIterator first, RandomIterator last,
+			BinaryPredicate pred, bool &already_partitioned)
+		{
+			const auto &pivot = *first;
+			auto l = first, r = last;
+			// choose_pivot ֤ҲڲСԪ
+			while (pred(*++l, pivot));
+			// ûСԪʱĲҪ߽
+			if (l - 1 == first)
+			{
+				while (l < r && !pred(*--r, pivot));
+			}
+			else
+			{
+				while (!pred(*--r, pivot));
+			}
+			already_partitioned = l >= r;
+			while (l < r)
+			{
+				swap(*l, *r);
+				while (pred(*++l, pivot));
+				while (!pred(*--r, pivot));
+			}
+			auto pivot_pos = l - 1;
+			swap(*first, *pivot_pos);
+			return pivot_pos;
+		}
+
+		// ѵԪضߣλã[first,pos] ڵԪض
+		template <typename RandomIterator,typename BinaryPredicate>
+		RandomIterator partition_left(RandomIterator first, RandomIterator last, BinaryPredicate pred)
+		{
+			const auto &pivot = *first;
+			auto l = first, r = last;
+			//  *first ͣ
+			while (pred(pivot, *--r));
+			if (r + 1 == last)
+			{
+				while (l < r && !pred(pivot, *++l));
+			}
+			else
+			{
+				while (!pred(pivot, *++l));
+			}
+			while (l < r)
+			{
+				swap(*l, *r);
+				while (pred(pivot, *--r));
+				while (!pred(pivot, *++l));
+			}
+			swap(*first, *r);
+			return r;
+		}
+
+		// ̶λõԪأÿ˻ģʽ
+		template <typename RandomIterator>
+		void break_patterns(RandomIterator first, RandomIterator last)
+		{
+			auto len = last - first;
+			if (len >= INSERTION_SORT_THRESHOLD)
+			{
+				auto quarter = len / 4;
+				swap(*first, *(first + quarter));
+				swap(*(last - 1), *(last - quarter));
+				if (len > NINTHER_THRESHOLD)
+				{
+					swap(*(first + 1), *(first + (quarter + 1)));
+					swap(*(first + 2), *(first + (quarter + 2)));
+					swap(*(last - 2), *(last - (quarter + 1)));
+					swap(*(last - 3), *(last - (quarter + 2)));
+				}
+			}
+		}
+
+		/*
+		* leftmost Ϊ false ʱ *(first-1) һᣬκԪأ
+		* ڱҲʶظԪ
+		*/
+		template <typename RandomIterator,typename BinaryPredicate>
+		void introsort_loop(RandomIterator first, RandomIterator last, BinaryPredicate pred,
+			int depth_limit, bool leftmost)
+		{
+			while (last - first > INSERTION_SORT_THRESHOLD)
+			{
+				if (depth_limit == 0)
+				{
+					miniSTL::make_heap(first, last, pred);
+					miniSTL::sort_heap(first, last, pred);
+					return;
+				}
+				--depth_limit;
+
+				auto len = last - first;
+				choose_pivot(first, last, pred);
+				if (!leftmost && !pred(*(first - 1), *first))
+				{
+					first = partition_left(first, last, pred) + 1;
+					continue;
+				}
+
+				bool already_partitioned;
+				auto pivot_pos = partition_right(first, last, pred, already_partitioned);
+				auto l_len = pivot_pos - first, r_len = last - (pivot_pos + 1);
+				bool highly_unbalanced = l_len < len / 8 || r_len < len / 8;
+				if (highly_unbalanced)
+				{
+					break_patterns(first, pivot_pos);
+					break_patterns(pivot_pos + 1, last);
+				}
+				else if (already_partitioned &&
+					partial_insertion_sort(first, pivot_pos, pred) &&
+					partial_insertion_sort(pivot_pos + 1, last, pred))
+				{
+					return;
+				}
+
+				// ݹ鴦϶̵һ࣬ϳһѭջȲ O(logN)
+				if (l_len < r_len)
+				{
+					introsort_loop(first, pivot_pos, pred, depth_limit, leftmost);
+					first = pivot_pos + 1;
+					leftmost = false;
+				}
+				else
+				{
+					introsort_loop(pivot_pos + 1, last, pred, depth_limit, false);
+					last = pivot_pos;
+				}
+			}
+			if (leftmost)
+				insertion_sort(first, last, pred);
+			else
+				unguarded_insertion_sort(first, last, pred);
+		}
+
+		template <typename Size>
+		inline int log2_floor(Size n)
+		{
+			int ret = 0;
+			while (n >>= 1)
+				++ret;
+			return ret;
+		}
+	}
+
+	template <typename RandomIterator,typename BinaryPredicate>
+	void sort(RandomIterator first, RandomIterator last, BinaryPredicate pred)
+	{
+		if (last - first < 2)
+			return;
+		introsort_loop(first, last, pred, 2 * log2_floor(last - first), true);
+	}
+
+	template <typename RandomIterator>
+	void sort(RandomIterator first, RandomIterator last)
+	{
+		return sort(first, last, less<typename iterator_traits<RandomIterator>::value_type>());
+	}
+
+	/*
+	* nth_element
+	* ƽ O(N) O(N)
+	* ʡѡintroselect sort ͬѡȡͻֻ֣ nth ڵһ
+	* ִ 2*log2(N) ʱλλmedian of mediansѡȡᣬ֤
+	*/
+	namespace
+	{
+		template <typename RandomIterator,typename BinaryPredicate>
+		void nth_element_aux(RandomIterator first, RandomIterator nth, RandomIterator last,
+			BinaryPredicate pred, bool leftmost);
+
+		// ÿ 5 Ԫȡλŵ俪ͷٵݹЩλλŵ *first
+		template <typename RandomIterator,typename BinaryPredicate>
+		void median_of_medians(RandomIterator first, RandomIterator last, BinaryPredicate pred)
+		{
+			auto len = last - first;
+			auto groups = len / 5;
+			for (decltype(len) i = 0;i != groups;++i)
+			{
+				auto group = first + i * 5;
+				insertion_sort(group, group + 5, pred);
+				swap(*(first + i), *(group + 2));
+			}
+			nth_element_aux(first, first + groups / 2, first + groups, pred, true);
+			swap(*first, *(first + groups / 2));
+		}
+
+		template <typename RandomIterator,typename BinaryPredicate>
+		void nth_element_aux(RandomIterator first, RandomIterator nth, RandomIterator last,
+			BinaryPredicate pred, bool leftmost)
+		{
+			int depth_limit = 2 * log2_floor(last - first);
+			while (last - first > INSERTION_SORT_THRESHOLD)
+			{
+				if (depth_limit == 0)
+				{
+					median_of_medians(first, last, pred);
+				}
+				else
+				{
+					--depth_limit;
+					choose_pivot(first, last, pred);
+				}
+
+				// һֵȣԪضѾλ
+				if (!leftmost && !pred(*(first - 1), *first))
+				{
+					auto pos = partition_left(first, last, pred);
+					if (nth <= pos)
+						return;
+					first = pos + 1;
+					continue;
+				}
+
+				bool already_partitioned;
+				auto pivot_pos = partition_right(first, last, pred, already_partitioned);
+				if (pivot_pos == nth)
+					return;
+				if (nth < pivot_pos)
+				{
+					last = pivot_pos;
+				}
+				else
+				{
+					first = pivot_pos + 1;
+					leftmost = false;
+				}
+			}
+			insertion_sort(first, last, pred);
+		}
+	}
+
+	template <typename RandomIterator,typename BinaryPredicate>
+	void nth_element(RandomIterator first, RandomIterator nth, RandomIterator last, BinaryPredicate pred)
+	{
+		if (nth == last || last - first < 2)
+			return;
+		nth_element_aux(first, nth, last, pred, true);
+	}
+
+	template <typename RandomIterator>
+	void nth_element(RandomIterator first, RandomIterator nth, RandomIterator last)
+	{
+		miniSTL::nth_element(first, nth, last, less<typename iterator_traits<RandomIterator>::value_type>());
+	}
+
+	/*
+	* partial_sort
+	* С middle-first Ԫذ˳ŵ [first,middle)Ԫص˳ȷ
+	* ȡԪؽʱ [first,middle) ά󶥶ɨԪأO(NlogK)
+	* ȡԪؽ϶ʱ nth_element ǰһ֣O(N+KlogK)
+	*/
+	template <typename RandomIterator,typename BinaryPredicate>
+	void partial_sort(RandomIterator first, RandomIterator middle, RandomIterator last, BinaryPredicate pred)
+	{
+		auto k = middle - first, len = last - first;
+		if (k == 0)
+			return;
+		if (k > len / 16)
+		{
+			miniSTL::nth_element(first, middle, last, pred);
+			miniSTL::sort(first, middle, pred);
+			return;
+		}
+		miniSTL::make_heap(first, middle, pred);
+		for (auto cur = middle;cur != last;++cur)
+		{
+			// ȶѶСԪ滻Ѷ
+			if (pred(*cur, *first))
+			{
+				auto value = std::move(*cur);
+				*cur = std::move(*first);
+				_dary_adjust_heap<2>(first, decltype(k)(0), k, std::move(value), pred);
+			}
+		}
+		miniSTL::sort_heap(first, middle, pred);
+	}
+
+	template <typename RandomIterator>
+	void partial_sort(RandomIterator first, RandomIterator middle, RandomIterator last)
+	{
+		miniSTL::partial_sort(first, middle, last, less<typename iterator_traits<RandomIterator>::value_type>());
+	}
+
+	/*
+	* partial_sort_copy
+	* O(NlogK)
+	*  [first,last) С K Ԫذ˳Ƶ䣬K Ϊ䳤ȵĽСֵ
+	* ؽһдԪصһλ
+	*/
+	template <typename InputIterator,typename RandomIterator,typename BinaryPredicate>
+	RandomIterator partial_sort_copy(InputIterator first, InputIterator last,
+		RandomIterator result_first, RandomIterator result_last, BinaryPredicate pred)
+	{
+		auto result_end = result_first;
+		for (;first != last && result_end != result_last;++first, ++result_end)
+			*result_end = *first;
+		if (result_end == result_first)
+			return result_end;
+		miniSTL::make_heap(result_first, result_end, pred);
+		const auto k = result_end - result_first;
+		for (;first != last;++first)
+		{
+			if (pred(*first, *result_first))
+			{
+				typename iterator_traits<RandomIterator>::value_type value = *first;
+				_dary_adjust_heap<2>(result_first, decltype(k)(0), k, std::move(value), pred);
+			}
+		}
+		miniSTL::sort_heap(result_first, result_end, pred);
+		return result_end;
+	}
+
+	template <typename InputIterator,typename RandomIterator>
+	RandomIterator partial_sort_copy(InputIterator first, InputIterator last,
+		RandomIterator result_first, RandomIterator result_last)
+	{
+		return miniSTL::partial_sort_copy(first, last, result_first, result_last,
+			less<typename iterator_traits<RandomIterator>::value_type>());
+	}
+
+	/*
+	* radix_sort / radix_sort_by_key
+	* ͸ LSD ÿ˴һֽڣO(N*sizeof(T))
+	*   һɨֽڵֱͼԪĳֽ϶ֱͬ
+	*   зתλ IEEE 754 λģʽ任֮󶼰޷
+	*    -0.0  0.0 ֮ǰNaN ˣbool һֽڵ 0/1 
+	*   Ԫ RADIX_SORT_THRESHOLD ʱ sort()ͬ任ļȽϣ˳һ
+	* ַchar  basic_stringstring_view ȣ MSD ͰԪ
+	* RADIX_SMALL_BUCKET ʱ sort()
+	* ȶģҪ O(N) Ķռ䣬֧ԭָԼ vector ĵ
+	* radix_sort_by_key  key(Ԫ) Ľkey ַʱ뷵Ԫڲַ
+	* û string_view ಻ӵݵĶڼֱЩַ
+	*/
+	namespace
+	{
+		enum { RADIX_SORT_THRESHOLD = 256, RADIX_SMALL_BUCKET = 32 };
+
+		template <typename T, bool IsFloat = std::is_floating_point<T>::value>
+		struct radix_key;
+
+		// зתλ޷Ƚϵ˳ԭһ
+		template <typename T>
+		struct radix_key<T, false>
+		{
+			typedef typename std::make_unsigned<T>::type type;
+
+			static type sign_mask()
+			{
+				return std::is_signed<T>::value ? static_cast<type>(type(1) << (sizeof(type) * 8 - 1)) : type(0);
+			}
+
+			static type encode(T v) { return static_cast<type>(static_cast<type>(v) ^ sign_mask()); }
+			static T decode(type u) { return static_cast<T>(static_cast<type>(u ^ sign_mask())); }
+		};
+
+		// bool ûжӦ޷ͣ 0/1 
+		template <>
+		struct radix_key<bool, false>
+		{
+			typedef unsigned char type;
+
+			static type encode(bool v) { return v ? 1 : 0; }
+			static bool decode(type u) { return u != 0; }
+		};
+
+		// ȡȫλǸ÷λ
+		template <typename T>
+		struct radix_key<T, true>
+		{
+			typedef typename std::conditional<sizeof(T) == 4, uint32_t, uint64_t>::type type;
+			static_assert(sizeof(T) == sizeof(type), "radix_sort supports only IEEE 754 float and double");
+
+			static const type SIGN = type(1) << (sizeof(type) * 8 - 1);
+
+			static type encode(T v)
+			{
+				type u;
+				memcpy(&u, &v, sizeof(u));
+				return (u & SIGN) ? ~u : (u | SIGN);
+			}
+
+			static T decode(type u)
+			{
+				u = (u & SIGN) ? (u ^ SIGN) : ~u;
+				T v;
+				memcpy(&v, &u, sizeof(v));
+				return v;
+			}
+		};
+
+		// ԭλõļ radix_sort_by_key ַ index Ԫ
+		template <typename U>
+		struct radix_keyed
+		{
+			U key;
+			size_t index;
+		};
+
+		template <typename U>
+		struct radix_identity_key
+		{
+			U operator()(U u) const { return u; }
+		};
+
+		template <typename U>
+		struct radix_keyed_key
+		{
+			U operator()(const radix_keyed<U> &k) const { return k.key; }
+		};
+
+		/*
+		*  a е n  LSD buf ΪͬСĸռ
+		* get_key ȡ޷żؽڵ飨a  buf
+		*/
+		template <typename U, typename Item, typename GetKey>
+		Item *lsd_radix_sort(Item *a, Item *buf, size_t n, GetKey get_key)
+		{
+			enum { BYTES = sizeof(U) };
+			size_t count[BYTES][256];
+			memset(count, 0, sizeof(count));
+			for (size_t i = 0;i != n;++i)
+			{
+				U k = get_key(a[i]);
+				for (int b = 0;b != BYTES;++b)
+					++count[b][(k >> (b * 8)) & 0xff];
+			}
+
+			const U first_key = get_key(a[0]);
+			for (int b = 0;b != BYTES;++b)
+			{
+				const unsigned shift = b * 8;
+				size_t *cnt = count[b];
+				// Ԫֽͬ˲ı˳
+				if (cnt[(first_key >> shift) & 0xff] == n)
+					continue;
+				size_t sum = 0;
+				for (int i = 0;i != 256;++i)
+				{
+					size_t c = cnt[i];
+					cnt[i] = sum;
+					sum += c;
+				}
+				for (size_t i = 0;i != n;++i)
+					buf[cnt[(get_key(a[i]) >> shift) & 0xff]++] = a[i];
+				Item *tmp = a;
+				a = buf;
+				buf = tmp;
+			}
+			return a;
+		}
+
+		//  order[i].index Ԫŵ first[i]
+		template <typename T, typename Keyed>
+		void radix_apply_order(T *first, size_t n, const Keyed *order)
+		{
+			T *buf = allocator<T>::allocate(n);
+			for (size_t i = 0;i != n;++i)
+				new(buf + i) T(std::move(first[order[i].index]));
+			for (size_t i = 0;i != n;++i)
+			{
+				first[i] = std::move(buf[i]);
+				buf[i].~T();
+			}
+			allocator<T>::deallocate(buf, n);
+		}
+
+		template <typename U>
+		struct radix_keyed_less
+		{
+			bool operator()(const radix_keyed<U> &a, const radix_keyed<U> &b) const
+			{
+				return a.key < b.key || (a.key == b.key && a.index < b.index);
+			}
+		};
+
+		template <typename T, typename Key>
+		void radix_sort_by_key_aux(T *first, T *last, Key key, _true_type)
+		{
+			typedef typename std::decay<decltype(key(*first))>::type key_type;
+			typedef radix_key<key_type> traits;
+			typedef typename traits::type U;
+
+			const size_t n = last - first;
+			if (n < 2)
+				return;
+			radix_keyed<U> *a = allocator<radix_keyed<U>>::allocate(n);
+			for (size_t i = 0;i != n;++i)
+			{
+				a[i].key = traits::encode(key(first[i]));
+				a[i].index = i;
+			}
+			radix_keyed<U> *res = a, *buf = nullptr;
+			if (n < RADIX_SORT_THRESHOLD)
+			{
+				miniSTL::sort(a, a + n, radix_keyed_less<U>());
+			}
+			else
+			{
+				buf = allocator<radix_keyed<U>>::allocate(n);
+				res = lsd_radix_sort<U>(a, buf, n, radix_keyed_key<U>());
+			}
+			radix_apply_order(first, n, res);
+			allocator<radix_keyed<U>>::deallocate(a, n);
+			if (buf)
+				allocator<radix_keyed<U>>::deallocate(buf, n);
+		}
+
+		// ַindex ΪԪԭλ
+		struct radix_str
+		{
+			const unsigned char *ptr;
+			size_t len;
+			size_t index;
+		};
+
+		//  depth ֽڵͰ0 ͰųȲ depth Ĵ
+		inline size_t radix_bucket(const radix_str &s, size_t depth)
+		{
+			return depth < s.len ? s.ptr[depth] + 1 : 0;
+		}
+
+		// ǰ depth ֽ֪ͬ depth ʼȽϣȫͬʱԭλñȶ
+		struct radix_str_less
+		{
+			size_t depth;
+
+			explicit radix_str_less(size_t d) :depth(d) {}
+
+			bool operator()(const radix_str &a, const radix_str &b) const
+			{
+				size_t alen = a.len - depth, blen = b.len - depth;
+				size_t n = alen < blen ? alen : blen;
+				int res = n ? memcmp(a.ptr + depth, b.ptr + depth, n) : 0;
+				if (res != 0)
+					return res < 0;
+				if (alen != blen)
+					return alen < blen;
+				return a.index < b.index;
+			}
+		};
+
+		/*
+		* ǰ depth ֽڶͬ n  MSD buf Ϊռ
+		* ͰѭﴦͰݹ飬ݹȲ O(logN)
+		*/
+		inline void msd_radix_sort(radix_str *a, radix_str *buf, size_t n, size_t depth)
+		{
+			while (n >= RADIX_SMALL_BUCKET)
+			{
+				size_t count[257];
+				memset(count, 0, sizeof(count));
+				for (size_t i = 0;i != n;++i)
+					++count[radix_bucket(a[i], depth)];
+				// дѽȫͬԭ˳򼴿
+				if (count[0] == n)
+					return;
+				// дֽͬ
+				if (count[radix_bucket(a[0], depth)] == n)
+				{
+					++depth;
+					continue;
+				}
+
+				size_t start[258];
+				start[0] = 0;
+				for (int i = 0;i != 257;++i)
+					start[i + 1] = start[i] + count[i];
+				size_t pos[257];
+				memcpy(pos, start, sizeof(pos));
+				for (size_t i = 0;i != n;++i)
+					buf[pos[radix_bucket(a[i], depth)]++] = a[i];
+				memcpy(a, buf, n * sizeof(radix_str));
+
+				// 0 ͰеĴѽ
+				int largest = 1;
+				for (int i = 2;i != 257;++i)
+				{
+					if (count[i] > count[largest])
+						largest = i;
+				}
+				for (int i = 1;i != 257;++i)
+				{
+					if (i != largest && count[i] > 1)
+						msd_radix_sort(a + start[i], buf + start[i], count[i], depth + 1);
+				}
+				a += start[largest];
+				buf += start[largest];
+				n = count[largest];
+				++depth;
+			}
+			if (n > 1)
+				miniSTL::sort(a, a + n, radix_str_less(depth));
+		}
+
+		template <typename T, typename Key>
+		void radix_sort_by_key_aux(T *first, T *last, Key key, _false_type)
+		{
+			typedef decltype(key(*first)) result_type;
+			typedef typename std::decay<result_type>::type key_type;
+			static_assert(std::is_lvalue_reference<result_type>::value || std::is_trivially_copyable<key_type>::value,
+				"radix_sort_by_key: key must return a reference to the element's string or a non-owning view");
+			static_assert(sizeof(*key(*first).data()) == 1, "radix_sort_by_key: string keys must be byte strings");
+
+			const size_t n = last - first;
+			if (n < 2)
+				return;
+			radix_str *a = allocator<radix_str>::allocate(n);
+			for (size_t i = 0;i != n;++i)
+			{
+				result_type k = key(first[i]);
+				a[i].ptr = reinterpret_cast<const unsigned char*>(k.data());
+				a[i].len = k.size();
+				a[i].index = i;
+			}
+			radix_str *buf = allocator<radix_str>::allocate(n);
+			msd_radix_sort(a, buf, n, 0);
+			radix_apply_order(first, n, a);
+			allocator<radix_str>::deallocate(buf, n);
+			allocator<radix_str>::deallocate(a, n);
+		}
+
+		// 任ļȽϣ˳ͬ NaN Ҳϸ
+		template <typename T>
+		struct radix_encoded_less
+		{
+			bool operator()(T a, T b) const
+			{
+				return radix_key<T>::encode(a) < radix_key<T>::encode(b);
+			}
+		};
+
+		template <typename T>
+		void radix_sort_aux(T *first, T *last, _true_type)
+		{
+			typedef radix_key<T> traits;
+			typedef typename traits::type U;
+
+			const size_t n = last - first;
+			if (n < RADIX_SORT_THRESHOLD)
+			{
+				miniSTL::sort(first, last, radix_encoded_less<T>());
+				return;
+			}
+			U *a = allocator<U>::allocate(n);
+			U *buf = allocator<U>::allocate(n);
+			for (size_t i = 0;i != n;++i)
+				a[i] = traits::encode(first[i]);
+			U *res = lsd_radix_sort<U>(a, buf, n, radix_identity_key<U>());
+			for (size_t i = 0;i != n;++i)
+				first[i] = traits::decode(res[i]);
+			allocator<U>::deallocate(buf, n);
+			allocator<U>::deallocate(a, n);
+		}
+
+		template <typename T>
+		struct radix_self_key
+		{
+			const T &operator()(const T &v) const { return v; }
+		};
+
+		template <typename T>
+		void radix_sort_aux(T *first, T *last, _false_type)
+		{
+			radix_sort_by_key_aux(first, last, radix_self_key<T>(), _false_type());
+		}
+	}
+
+	template <typename T>
+	void radix_sort(T *first, T *last)
+	{
+		typedef typename FirstOrSecond<std::is_arithmetic<T>::value, _true_type, _false_type>::result is_arithmetic;
+		radix_sort_aux(first, last, is_arithmetic());
+	}
+
+	template <typename T, typename Key>
+	void radix_sort_by_key(T *first, T *last, Key key)
+	{
+		typedef typename std::decay<decltype(key(*first))>::type key_type;
+		typedef typename FirstOrSecond<std::is_arithmetic<key_type>::value, _true_type, _false_type>::result is_arithmetic;
+		radix_sort_by_key_aux(first, last, key, is_arithmetic());
+	}
+
+	/*
+	* merge
+	* O(N)
+	* 鲢 resultȵԪصһǰ
+	*/
+	template <typename InputIterator1,typename InputIterator2,typename OutputIterator,typename Compare>
+	OutputIterator merge(InputIterator1 first1, InputIterator1 last1,
+		InputIterator2 first2, InputIterator2 last2, OutputIterator result, Compare comp)
+	{
+		while (first1 != last1 && first2 != last2)
+		{
+			if (comp(*first2, *first1))
+			{
+				*result = *first2;
+				++first2;
+			}
+			else
+			{
+				*result = *first1;
+				++first1;
+			}
+			++result;
+		}
+		for (;first1 != last1;++first1, ++result)
+			*result = *first1;
+		for (;first2 != last2;++first2, ++result)
+			*result = *first2;
+		return result;
+	}
+
+	template <typename InputIterator1,typename InputIterator2,typename OutputIterator>
+	OutputIterator merge(InputIterator1 first1, InputIterator1 last1,
+		InputIterator2 first2, InputIterator2 last2, OutputIterator result)
+	{
+		return miniSTL::merge(first1, last1, first2, last2, result,
+			less<typename iterator_traits<InputIterator1>::value_type>());
+	}
+
+	/*
+	* stable_sort / inplace_merge
+	* stable_sort  timsort
+	*   ҳеΣϸξ͵طת minrun Ķöֲ
+	*   γջУ timsort Ĳʽϲ֤ܴ O(NlogN)
+	*   ϲǰָңgallopingȥβѾλĲ֣
+	*   ϲʱĳһʤ min_gallop ξлָңƶԪ
+	* ˻ӽʱ
+	* ϲõʱռ merge_buffer  allocator 룬һзʹã N/2 Ԫ
+	*/
+	namespace
+	{
+		enum { TIMSORT_MIN_MERGE = 64, TIMSORT_MIN_GALLOP = 7, TIMSORT_MAX_RUNS = 96 };
+
+		/*
+		* 鲢õδʼʱռ䣬ʱ 2 ൽ limit Ԫ
+		* ҲʹõṩĿռ䣬ʱֻҪþͲ
+		*/
+		template <typename T>
+		class merge_buffer
+		{
+		private:
+			T *ptr;
+			size_t cap;
+			size_t limit;
+			bool owned;
+
+		public:
+			explicit merge_buffer(size_t limit) :ptr(nullptr), cap(0), limit(limit), owned(false) {}
+			merge_buffer(T *storage, size_t n) :ptr(storage), cap(n), limit(n), owned(false) {}
+			~merge_buffer()
+			{
+				if (owned)
+					allocator<T>::deallocate(ptr, cap);
+			}
+
+			merge_buffer(const merge_buffer&) = delete;
+			merge_buffer &operator=(const merge_buffer&) = delete;
+
+			T *get(size_t n)
+			{
+				if (n > cap)
+				{
+					if (owned)
+						allocator<T>::deallocate(ptr, cap);
+					size_t new_cap = 1;
+					while (new_cap < n)
+						new_cap *= 2;
+					if (new_cap > limit && limit >= n)
+						new_cap = limit;
+					ptr = allocator<T>::allocate(new_cap);
+					cap = new_cap;
+					owned = true;
+				}
+				return ptr;
+			}
+		};
+
+		/*
+		*  base[0,len) ָңǰ׺ȣ
+		*   right Ϊ false ʱС key ԪظΪ true ʱǲ key Ԫظ
+		* from_end Ϊ true ʱĩβʼң𰸿ĩβʱ
+		*/
+		template <typename RandomIterator,typename T,typename Compare>
+		typename iterator_traits<RandomIterator>::difference_type
+			gallop(const T &key, RandomIterator base,
+				typename iterator_traits<RandomIterator>::difference_type len,
+				bool right, bool from_end, Compare &comp)
+		{
+			typedef typename iterator_traits<RandomIterator>::difference_type diff_t;
+			auto in_prefix = [&](diff_t i) { return right ? !comp(key, base[i]) : comp(base[i], key); };
+			if (len == 0)
+				return 0;
+			diff_t lo, hi;
+			if (!from_end)
+			{
+				if (!in_prefix(0))
+					return 0;
+				diff_t last = 0, ofs = 1;
+				while (ofs < len && in_prefix(ofs))
+				{
+					last = ofs;
+					ofs = ofs * 2 + 1;
+				}
+				lo = last + 1;
+				hi = ofs < len ? ofs : len;
+			}
+			else
+			{
+				if (in_prefix(len - 1))
+					return len;
+				diff_t last = 0, ofs = 1;
+				while (ofs < len && !in_prefix(len - 1 - ofs))
+				{
+					last = ofs;
+					ofs = ofs * 2 + 1;
+				}
+				lo = ofs < len ? len - ofs : 0;
+				hi = len - 1 - last;
+			}
+			//  [lo,hi] 
+			while (lo < hi)
+			{
+				diff_t mid = lo + (hi - lo) / 2;
+				if (in_prefix(mid))
+					lo = mid + 1;
+				else
+					hi = mid;
+			}
+			return lo;
+		}
+
+		/*
+		* 鲢ڵ [a,a+len1)  [a+len1,a+len1+len2)len1 <= len2 ʱʹ
+		* ѵһƵʱռ䣬ǰ鲢
+		*/
+		template <typename RandomIterator,typename T,typename Compare>
+		void merge_lo(RandomIterator a, typename iterator_traits<RandomIterator>::difference_type len1,
+			typename iterator_traits<RandomIterator>::difference_type len2,
+			merge_buffer<T> &buffer, int &min_gallop, Compare &comp)
+		{
+			typedef typename iterator_traits<RandomIterator>::difference_type diff_t;
+			T *tmp = buffer.get(len1);
+			for (diff_t i = 0;i != len1;++i)
+				new(tmp + i) T(std::move(a[i]));
+
+			T *c1 = tmp, *e1 = tmp + len1;
+			RandomIterator c2 = a + len1, e2 = c2 + len2, dest = a;
+			while (c1 != e1 && c2 != e2)
+			{
+				diff_t count1 = 0, count2 = 0;
+				// Ƚϣֱĳһʤ min_gallop 
+				do
+				{
+					if (comp(*c2, *c1))
+					{
+						*dest++ = std::move(*c2++);
+						++count2;
+						count1 = 0;
+						if (c2 == e2)
+							goto done;
+					}
+					else
+					{
+						*dest++ = std::move(*c1++);
+						++count1;
+						count2 = 0;
+						if (c1 == e1)
+							goto done;
+					}
+				} while ((count1 | count2) < min_gallop);
+
+				// ָңƶ
+				do
+				{
+					count1 = gallop(*c2, c1, e1 - c1, true, false, comp);
+					for (diff_t i = 0;i != count1;++i)
+						*dest++ = std::move(*c1++);
+					if (c1 == e1)
+						goto done;
+					*dest++ = std::move(*c2++);
+					if (c2 == e2)
+						goto done;
+
+					count2 = gallop(*c1, c2, e2 - c2, false, false, comp);
+					for (diff_t i = 0;i != count2;++i)
+						*dest++ = std::move(*c2++);
+					if (c2 == e2)
+						goto done;
+					*dest++ = std::move(*c1++);
+					if (c1 == e1)
+						goto done;
+					if (min_gallop > 1)
+						--min_gallop;
+				} while (count1 >= TIMSORT_MIN_GALLOP || count2 >= TIMSORT_MIN_GALLOP);
+				min_gallop += 2;
+			}
+		done:
+			// ڶʣµԪѾԭλ
+			while (c1 != e1)
+				*dest++ = std::move(*c1++);
+			for (diff_t i = 0;i != len1;++i)
+				tmp[i].~T();
+		}
+
+		// len1 > len2 ʱʹãѵڶƵʱռ䣬Ӻǰ鲢
+		template <typename RandomIterator,typename T,typename Compare>
+		void merge_hi(RandomIterator a, typename iterator_traits<RandomIterator>::difference_type len1,
+			typename iterator_traits<RandomIterator>::difference_type len2,
+			merge_buffer<T> &buffer, int &min_gallop, Compare &comp)
+		{
+			typedef typename iterator_traits<RandomIterator>::difference_type diff_t;
+			T *tmp = buffer.get(len2);
+			RandomIterator b = a + len1;
+			for (diff_t i = 0;i != len2;++i)
+				new(tmp + i) T(std::move(b[i]));
+
+			RandomIterator c1 = b, dest = b + len2;
+			T *c2 = tmp + len2;
+			while (c1 != a && c2 != tmp)
+			{
+				diff_t count1 = 0, count2 = 0;
+				do
+				{
+					if (comp(*(c2 - 1), *(c1 - 1)))
+					{
+						*--dest = std::move(*--c1);
+						++count1;
+						count2 = 0;
+						if (c1 == a)
+							goto done;
+					}
+					else
+					{
+						*--dest = std::move(*--c2);
+						++count2;
+						count1 = 0;
+						if (c2 == tmp)
+							goto done;
+					}
+				} while ((count1 | count2) < min_gallop);
+
+				do
+				{
+					// һдڵڶĩβԪصĲ
+					count1 = (c1 - a) - gallop(*(c2 - 1), a, c1 - a, true, true, comp);
+					for (diff_t i = 0;i != count1;++i)
+						*--dest = std::move(*--c1);
+					if (c1 == a)
+						goto done;
+					*--dest = std::move(*--c2);
+					if (c2 == tmp)
+						goto done;
+
+					// ڶвСڵһĩβԪصĲ
+					count2 = (c2 - tmp) - gallop(*(c1 - 1), tmp, c2 - tmp, false, true, comp);
+					for (diff_t i = 0;i != count2;++i)
+						*--dest = std::move(*--c2);
+					if (c2 == tmp)
+						goto done;
+					*--dest = std::move(*--c1);
+					if (c1 == a)
+						goto done;
+					if (min_gallop > 1)
+						--min_gallop;
+				} while (count1 >= TIMSORT_MIN_GALLOP || count2 >= TIMSORT_MIN_GALLOP);
+				min_gallop += 2;
+			}
+		done:
+			// һʣµԪѾԭλ
+			while (c2 != tmp)
+				*--dest = std::move(*--c2);
+			for (diff_t i = 0;i != len2;++i)
+				tmp[i].~T();
+		}
+
+		// 鲢ڵΣȥβѾλԪ
+		template <typename RandomIterator,typename T,typename Compare>
+		void merge_runs(RandomIterator a, typename iterator_traits<RandomIterator>::difference_type len1,
+			typename iterator_traits<RandomIterator>::difference_type len2,
+			merge_buffer<T> &buffer, int &min_gallop, Compare &comp)
+		{
+			if (len1 == 0 || len2 == 0)
+				return;
+			RandomIterator b = a + len1;
+			// һв *b ԪѾλ
+			auto k = gallop(*b, a, len1, true, false, comp);
+			a += k;
+			len1 -= k;
+			if (len1 == 0)
+				return;
+			// ڶвСڵһĩβԪصԪѾλ
+			len2 = gallop(*(b - 1), b, len2, false, true, comp);
+			if (len2 == 0)
+				return;
+			if (len1 <= len2)
+				merge_lo(a, len1, len2, buffer, min_gallop, comp);
+			else
+				merge_hi(a, len1, len2, buffer, min_gallop, comp);
+		}
+
+		// [first,start) Ѿöֲ [start,last) Ԫ룬ȶ
+		template <typename RandomIterator,typename Compare>
+		void binary_insertion_sort(RandomIterator first, RandomIterator start, RandomIterator last, Compare &comp)
+		{
+			if (start == first)
+				++start;
+			for (;start < last;++start)
+			{
+				auto pivot = std::move(*start);
+				RandomIterator lo = first, hi = start;
+				while (lo < hi)
+				{
+					RandomIterator mid = lo + (hi - lo) / 2;
+					if (comp(pivot, *mid))
+						hi = mid;
+					else
+						lo = mid + 1;
+				}
+				for (RandomIterator p = start;p != lo;--p)
+					*p = std::move(*(p - 1));
+				*lo = std::move(pivot);
+			}
+		}
+
+		// ش first ʼεĳȣϸλᱻת
+		template <typename RandomIterator,typename Compare>
+		typename iterator_traits<RandomIterator>::difference_type
+			count_run_and_make_ascending(RandomIterator first, RandomIterator last, Compare &comp)
+		{
+			RandomIterator run = first + 1;
+			if (run == last)
+				return 1;
+			if (comp(*run, *first))
+			{
+				++run;
+				while (run < last && comp(*run, *(run - 1)))
+					++run;
+				for (RandomIterator l = first, r = run - 1;l < r;++l, --r)
+					swap(*l, *r);
+			}
+			else
+			{
+				++run;
+				while (run < last && !comp(*run, *(run - 1)))
+					++run;
+			}
+			return run - first;
+		}
+
+		//  [MIN_MERGE/2,MIN_MERGE] еĶγޣʹ n/minrun ӽ 2 
+		template <typename Size>
+		Size timsort_min_run(Size n)
+		{
+			Size r = 0;
+			while (n >= TIMSORT_MIN_MERGE)
+			{
+				r |= n & 1;
+				n >>= 1;
+			}
+			return n + r;
+		}
+
+		template <typename RandomIterator,typename T,typename Compare>
+		void timsort(RandomIterator first, RandomIterator last, Compare comp, merge_buffer<T> &buffer)
+		{
+			typedef typename iterator_traits<RandomIterator>::difference_type diff_t;
+			diff_t n = last - first;
+			if (n < 2)
+				return;
+			if (n < TIMSORT_MIN_MERGE)
+			{
+				auto run = count_run_and_make_ascending(first, last, comp);
+				binary_insertion_sort(first, first + run, last, comp);
+				return;
+			}
+
+			diff_t run_base[TIMSORT_MAX_RUNS], run_len[TIMSORT_MAX_RUNS];
+			int runs = 0;
+			int min_gallop = TIMSORT_MIN_GALLOP;
+			const diff_t min_run = timsort_min_run(n);
+			auto merge_at = [&](int i)
+			{
+				merge_runs(first + run_base[i], run_len[i], run_len[i + 1], buffer, min_gallop, comp);
+				run_len[i] += run_len[i + 1];
+				if (i == runs - 3)
+				{
+					run_base[i + 1] = run_base[i + 2];
+					run_len[i + 1] = run_len[i + 2];
+				}
+				--runs;
+			};
+
+			for (diff_t lo = 0;lo < n;)
+			{
+				diff_t len = count_run_and_make_ascending(first + lo, last, comp);
+				if (len < min_run)
+				{
+					diff_t force = n - lo < min_run ? n - lo : min_run;
+					binary_insertion_sort(first + lo, first + (lo + len), first + (lo + force), comp);
+					len = force;
+				}
+				run_base[runs] = lo;
+				run_len[runs] = len;
+				++runs;
+				lo += len;
+
+				// άֲʽ len[i-2] > len[i-1] + len[i]  len[i-1] > len[i]
+				while (runs > 1)
+				{
+					int k = runs - 2;
+					if ((k > 0 && run_len[k - 1] <= run_len[k] + run_len[k + 1]) ||
+						(k > 1 && run_len[k - 2] <= run_len[k - 1] + run_len[k]))
+					{
+						if (run_len[k - 1] < run_len[k + 1])
+							--k;
+						merge_at(k);
+					}
+					else if (run_len[k] <= run_len[k + 1])
+					{
+						merge_at(k);
+					}
+					else
+					{
+						break;
+					}
+				}
+			}
+			while (runs > 1)
+			{
+				int k = runs - 2;
+				if (k > 0 && run_len[k - 1] < run_len[k + 1])
+					--k;
+				merge_at(k);
+			}
+		}
+	}
+
+	template <typename RandomIterator,typename Compare>
+	void stable_sort(RandomIterator first, RandomIterator last, Compare comp)
+	{
+		typedef typename iterator_traits<RandomIterator>::value_type T;
+		merge_buffer<T> buffer(static_cast<size_t>(last - first) / 2 + 1);
+		timsort(first, last, comp, buffer);
+	}
+
+	template <typename RandomIterator>
+	void stable_sort(RandomIterator first, RandomIterator last)
+	{
+		miniSTL::stable_sort(first, last, less<typename iterator_traits<RandomIterator>::value_type>());
+	}
+
+	/*
+	* inplace_merge
+	* O(N)
+	* 鲢ڵ [first,middle)  [middle,last)ʱռΪ϶һεĳ
+	*/
+	template <typename RandomIterator,typename Compare>
+	void inplace_merge(RandomIterator first, RandomIterator middle, RandomIterator last, Compare comp)
+	{
+		typedef typename iterator_traits<RandomIterator>::value_type T;
+		auto len1 = middle - first, len2 = last - middle;
+		merge_buffer<T> buffer(static_cast<size_t>(len1 < len2 ? len1 : len2));
+		int min_gallop = TIMSORT_MIN_GALLOP;
+		merge_runs(first, len1, len2, buffer, min_gallop, comp);
+	}
+
+	template <typename RandomIterator>
+	void inplace_merge(RandomIterator first, RandomIterator middle, RandomIterator last)
+	{
+		miniSTL::inplace_merge(first, middle, last, less<typename iterator_traits<RandomIterator>::value_type>());
+	}
+
+	/*
+	* generate
+	* O(N)
+	*/
+	template <typename InputIterator,typename Function>
+	void generate(InputIterator first, InputIterator last, Function fn)
+	{
+		for (;first != last;++first)
+		{
+			*first = fn();
+		}
+	}
+
+	/*
+	* generate_n
+	* O(N)
+	*/
+	template <typename OutputIterator,typename Size,typename Generator>
+	void generate_n(OutputIterator first, Size n, Generator gen)
+	{
+		while (n--)
+		{
+			*first = gen();
+			++first;
+		}
+	}
+
+	/*
+	* Distance
+	* O(N)
+	*/
+	template <typename InputIterator>
+	typename iterator_traits<InputIterator>::difference_type
+		_distance(InputIterator first, InputIterator last, input_iterator_tag)
+	{
+		typename iterator_traits<InputIterator>::difference_type dist = 0;
+		while (first++ != last)
+		{
+			++dist;
+		}
+		return dist;
+	}
+
+	template <typename RandomIterator>
+	typename iterator_traits<RandomIterator>::difference_type
+		_distance(RandomIterator first, RandomIterator last, random_access_iterator_tag)
+	{
+		auto dist = last - first;
+		return dist;
+	}
+
+	template <typename Iterator>
+	typename iterator_traits<Iterator>::difference_type
+		distance(Iterator first, Iterator last)
+	{
+		typedef typename iterator_traits<Iterator>::iterator_category iterator_category;
+		return _distance(first, last, iterator_category());
+	}
+
+	/*
+	* lower_bound / upper_bound / binary_search / equal_range
+	* O(logN)
+	* ʵʹ޷֧ĶֲңÿֻȽһΣ͸㣬
+	* ѭֻȡ䳤ȣΪ֧Ԥʧܶͣ٣
+	* ÿͬʱԤȡһܵе㣬÷ô뱾ֵıȽص
+	* ʹͨĶֲ
+	*/
+	namespace
+	{
+		template <typename ForwardIterator,typename T,typename Compare>
+		ForwardIterator lower_bound_aux(ForwardIterator first, ForwardIterator last,
+			const T &value, Compare &comp, forward_iterator_tag)
+		{
+			auto len = miniSTL::distance(first, last);
+			while (len > 0)
+			{
+				auto half = len / 2;
+				auto mid = first;
+				miniSTL::advance(mid, half);
+				if (comp(*mid, value))
+				{
+					first = ++mid;
+					len -= half + 1;
+				}
+				else
+				{
+					len = half;
+				}
+			}
+			return first;
+		}
+
+		template <typename RandomIterator,typename T,typename Compare>
+		RandomIterator lower_bound_aux(RandomIterator first, RandomIterator last,
+			const T &value, Compare &comp, random_access_iterator_tag)
+		{
+			auto len = last - first;
+			if (len == 0)
+				return first;
+			while (len > 1)
+			{
+				auto half = len / 2;
+				len -= half;
+				simd::prefetch(&*(first + len / 2));
+				simd::prefetch(&*(first + (half + len / 2)));
+				first = comp(*(first + half), value) ? first + half : first;
+			}
+			return comp(*first, value) ? first + 1 : first;
+		}
+
+		template <typename ForwardIterator,typename T,typename Compare>
+		ForwardIterator upper_bound_aux(ForwardIterator first, ForwardIterator last,
+			const T &value, Compare &comp, forward_iterator_tag)
+		{
+			auto len = miniSTL::distance(first, last);
+			while (len > 0)
+			{
+				auto half = len / 2;
+				auto mid = first;
+				miniSTL::advance(mid, half);
+				if (!comp(value, *mid))
+				{
+					first = ++mid;
+					len -= half + 1;
+				}
+				else
+				{
+					len = half;
+				}
+			}
+			return first;
+		}
+
+		template <typename RandomIterator,typename T,typename Compare>
+		RandomIterator upper_bound_aux(RandomIterator first, RandomIterator last,
+			const T &value, Compare &comp, random_access_iterator_tag)
+		{
+			auto len = last - first;
+			if (len == 0)
+				return first;
+			while (len > 1)
+			{
+				auto half = len / 2;
+				len -= half;
+				simd::prefetch(&*(first + len / 2));
+				simd::prefetch(&*(first + (half + len / 2)));
+				first = !comp(value, *(first + half)) ? first + half : first;
+			}
+			return !comp(value, *first) ? first + 1 : first;
+		}
+	}
+
+	// صһС value λ
+	template <typename ForwardIterator,typename T,typename Compare>
+	ForwardIterator lower_bound(ForwardIterator first, ForwardIterator last, const T &value, Compare comp)
+	{
+		typedef typename iterator_traits<ForwardIterator>::iterator_category iterator_category;
+		return lower_bound_aux(first, last, value, comp, iterator_category());
+	}
+
+	template <typename ForwardIterator,typename T>
+	ForwardIterator lower_bound(ForwardIterator first, ForwardIterator last, const T &value)
+	{
+		return miniSTL::lower_bound(first, last, value,
+			less<typename iterator_traits<ForwardIterator>::value_type>());
+	}
+
+	// صһ value λ
+	template <typename ForwardIterator,typename T,typename Compare>
+	ForwardIterator upper_bound(ForwardIterator first, ForwardIterator last, const T &value, Compare comp)
+	{
+		typedef typename iterator_traits<ForwardIterator>::iterator_category iterator_category;
+		return upper_bound_aux(first, last, value, comp, iterator_category());
+	}
+
+	template <typename ForwardIterator,typename T>
+	ForwardIterator upper_bound(ForwardIterator first, ForwardIterator last, const T &value)
+	{
+		return miniSTL::upper_bound(first, last, value,
+			less<typename iterator_traits<ForwardIterator>::value_type>());
+	}
+
+	template <typename ForwardIterator,typename T,typename Compare>
+	bool binary_search(ForwardIterator first, ForwardIterator last, const T &value, Compare comp)
+	{
+		auto it = miniSTL::lower_bound(first, last, value, comp);
+		return it != last && !comp(value, *it);
+	}
+
+	template <typename ForwardIterator,typename T>
+	bool binary_search(ForwardIterator first, ForwardIterator last, const T &value)
 	{
-		return miniSTL::search(first1, first2, first2, last2,
-			miniSTL::equal_to<typename miniSTL::iterator_traits<ForwardIterator1>::value_type>());
+		return miniSTL::binary_search(first, last, value,
+			less<typename iterator_traits<ForwardIterator>::value_type>());
+	}
+
+	template <typename ForwardIterator,typename T,typename Compare>
+	pair<ForwardIterator, ForwardIterator>
+		equal_range(ForwardIterator first, ForwardIterator last, const T &value, Compare comp)
+	{
+		auto lo = miniSTL::lower_bound(first, last, value, comp);
+		return pair<ForwardIterator, ForwardIterator>(lo, miniSTL::upper_bound(lo, last, value, comp));
+	}
+
+	template <typename ForwardIterator,typename T>
+	pair<ForwardIterator, ForwardIterator>
+		equal_range(ForwardIterator first, ForwardIterator last, const T &value)
+	{
+		return miniSTL::equal_range(first, last, value,
+			less<typename iterator_traits<ForwardIterator>::value_type>());
 	}
 
 	/*
-	* advance
-	* O(N)
+	* lower_bound_batch
+	*  [values_first,values_last) еÿֵ [first,last)  lower_bound
+	* д result
+	* ÿ BATCH_SEARCH_WIDTH ҽִУͬһиҷʻصλã
+	* CPU ͬʱȴλȱʧÿҶԤȡԼһֵе
+	* ʺϲұԶڻ桢һҪֵܶĳ
 	*/
 	namespace
 	{
-		template <typename InputIterator,typename Distance>
-		void _advance(InputIterator &it, Distance n, input_iterator_tag)
+		enum { BATCH_SEARCH_WIDTH = 16 };
+	}
+
+	template <typename RandomIterator,typename ForwardIterator,typename OutputIterator,typename Compare>
+	OutputIterator lower_bound_batch(RandomIterator first, RandomIterator last,
+		ForwardIterator values_first, ForwardIterator values_last, OutputIterator result, Compare comp)
+	{
+		const auto len = last - first;
+		RandomIterator base[BATCH_SEARCH_WIDTH];
+		ForwardIterator values[BATCH_SEARCH_WIDTH];
+		while (values_first != values_last)
 		{
-			assert(n >= 0);
-			while (n--)
+			int count = 0;
+			for (;count != BATCH_SEARCH_WIDTH && values_first != values_last;++count, ++values_first)
 			{
-				++it;
+				base[count] = first;
+				values[count] = values_first;
+			}
+			if (len != 0)
+			{
+				for (auto n = len;n > 1;)
+				{
+					auto half = n / 2;
+					n -= half;
+					for (int i = 0;i != count;++i)
+					{
+						base[i] = comp(*(base[i] + half), *values[i]) ? base[i] + half : base[i];
+						simd::prefetch(&*(base[i] + n / 2));
+					}
+				}
+				for (int i = 0;i != count;++i)
+				{
+					if (comp(*base[i], *values[i]))
+						++base[i];
+				}
 			}
+			for (int i = 0;i != count;++i, ++result)
+				*result = base[i];
 		}
+		return result;
+	}
 
-		template <typename BidirectionalIterator,typename Distance>
-		void _advance(BidirectionalIterator &it, Distance n, bidirectional_iterator_tag)
+	template <typename RandomIterator,typename ForwardIterator,typename OutputIterator>
+	OutputIterator lower_bound_batch(RandomIterator first, RandomIterator last,
+		ForwardIterator values_first, ForwardIterator values_last, OutputIterator result)
+	{
+		return miniSTL::lower_bound_batch(first, last, values_first, values_last, result,
+			less<typename iterator_traits<RandomIterator>::value_type>());
+	}
+
+	/*
+	* is_permutation
+	* ͬǰ׺ʣಿ֣
+	*   ʹĬϵȱȽϡԪΪͬһͣbool ⣩Ҳ PERMUTATION_SORT_THRESHOLD ʱ
+	*   ߸ƵʱռֱȽϣO(N)
+	*   ʹĬϵȱȽϡԪ֧ͬ operator< ʱ stringpair
+	*   ͬƵʱռ䣬 sort ȽϣO(NlogN)Ҫ operator<  operator== һ£
+	*    NaN κֵȣʣಿֳ NaN ʱһ
+	*   ÿֵͬȽֵ߳ĴO(N*N)
+	*/
+	template <typename ForwardIterator1,typename ForwardIterator2>
+	struct _is_permutation_sortable
+	{
+		typedef typename iterator_traits<ForwardIterator1>::value_type value_type1;
+		typedef typename iterator_traits<ForwardIterator2>::value_type value_type2;
+		static const bool value = std::is_same<value_type1, value_type2>::value &&
+			std::is_integral<value_type1>::value && !std::is_same<value_type1, bool>::value;
+		typedef typename FirstOrSecond<value, _true_type, _false_type>::result type;
+	};
+
+	// Ԫͬ value_type ֧ operator< ʱΪ _true_type
+	template <typename ForwardIterator1,typename ForwardIterator2>
+	struct _is_permutation_comparable
+	{
+	private:
+		typedef typename iterator_traits<ForwardIterator1>::value_type value_type1;
+		typedef typename iterator_traits<ForwardIterator2>::value_type value_type2;
+
+		template <typename U>
+		static auto test(int) -> decltype(std::declval<const U&>() < std::declval<const U&>(), _true_type());
+		template <typename U>
+		static _false_type test(...);
+
+	public:
+		static const bool value = std::is_same<value_type1, value_type2>::value &&
+			std::is_same<decltype(test<value_type1>(0)), _true_type>::value;
+		typedef typename FirstOrSecond<value, _true_type, _false_type>::result type;
+	};
+
+	namespace
+	{
+		enum { PERMUTATION_SORT_THRESHOLD = 64 };
+
+		template <typename ForwardIterator1,typename ForwardIterator2,typename BinaryPredicate>
+		bool _is_permutation_count(ForwardIterator1 first1, ForwardIterator1 last1,
+			ForwardIterator2 first2, ForwardIterator2 last2, BinaryPredicate &pred)
 		{
-			if (n < 0)
+			for (auto it1 = first1;it1 != last1;++it1)
 			{
-				while (n++)
+				// ǰĳԪȵֵѾͳƹ
+				auto prev = first1;
+				while (prev != it1 && !pred(*prev, *it1))
+					++prev;
+				if (prev != it1)
+					continue;
+
+				size_t n2 = 0;
+				for (auto it2 = first2;it2 != last2;++it2)
 				{
-					--it;
+					if (pred(*it1, *it2))
+						++n2;
 				}
-			}
-			else
-			{
-				while (n--)
+				if (n2 == 0)
+					return false;
+				size_t n1 = 1;
+				for (auto it = it1;++it != last1;)
 				{
-					++it;
+					if (pred(*it1, *it))
+						++n1;
 				}
+				if (n1 != n2)
+					return false;
 			}
+			return true;
 		}
 
-		template <typename RandomIterator,typename Distance>
-		void _advance(RandomIterator &it, Distance n, random_access_iterator_tag)
+		template <typename ForwardIterator1,typename ForwardIterator2>
+		bool _is_permutation_sort(ForwardIterator1 first1, ForwardIterator1 last1,
+			ForwardIterator2 first2, ForwardIterator2 last2, _false_type)
 		{
-			if (n < 0)
-			{
-				it -= (-n);
-			}
-			else
+			equal_to<typename iterator_traits<ForwardIterator1>::value_type> pred;
+			return _is_permutation_count(first1, last1, first2, last2, pred);
+		}
+
+		template <typename ForwardIterator>
+		bool _contains_nan(ForwardIterator, ForwardIterator, _false_type)
+		{
+			return false;
+		}
+
+		template <typename ForwardIterator>
+		bool _contains_nan(ForwardIterator first, ForwardIterator last, _true_type)
+		{
+			for (;first != last;++first)
 			{
-				it += n;
+				if (*first != *first)
+					return true;
 			}
+			return false;
+		}
+
+		template <typename ForwardIterator1,typename ForwardIterator2>
+		bool _is_permutation_sort(ForwardIterator1 first1, ForwardIterator1 last1,
+			ForwardIterator2 first2, ForwardIterator2 last2, _true_type)
+		{
+			typedef typename iterator_traits<ForwardIterator1>::value_type T;
+			const size_t n = static_cast<size_t>(miniSTL::distance(first1, last1));
+			if (n < PERMUTATION_SORT_THRESHOLD)
+				return _is_permutation_sort(first1, last1, first2, last2, _false_type());
+			typedef typename FirstOrSecond<std::is_floating_point<T>::value, _true_type, _false_type>::result is_float;
+			if (_contains_nan(first1, last1, is_float()) || _contains_nan(first2, last2, is_float()))
+				return false;
+
+			T *buf = allocator<T>::allocate(2 * n);
+			T *p = buf;
+			for (;first1 != last1;++first1, ++p)
+				new(p) T(*first1);
+			for (;first2 != last2;++first2, ++p)
+				new(p) T(*first2);
+			miniSTL::sort(buf, buf + n, less<T>());
+			miniSTL::sort(buf + n, buf + 2 * n, less<T>());
+			bool result = miniSTL::equal(buf, buf + n, buf + n);
+			for (p = buf;p != buf + 2 * n;++p)
+				p->~T();
+			allocator<T>::deallocate(buf, 2 * n);
+			return result;
+		}
+
+		template <typename ForwardIterator1,typename ForwardIterator2>
+		bool _is_permutation_aux(ForwardIterator1 first1, ForwardIterator1 last1,
+			ForwardIterator2 first2, ForwardIterator2 last2, _false_type)
+		{
+			typedef typename _is_permutation_comparable<ForwardIterator1, ForwardIterator2>::type is_comparable;
+			return _is_permutation_sort(first1, last1, first2, last2, is_comparable());
+		}
+
+		template <typename ForwardIterator1,typename ForwardIterator2>
+		bool _is_permutation_aux(ForwardIterator1 first1, ForwardIterator1 last1,
+			ForwardIterator2 first2, ForwardIterator2 last2, _true_type)
+		{
+			typedef typename iterator_traits<ForwardIterator1>::value_type T;
+			const size_t n = static_cast<size_t>(miniSTL::distance(first1, last1));
+			if (n < PERMUTATION_SORT_THRESHOLD)
+				return _is_permutation_sort(first1, last1, first2, last2, _false_type());
+
+			T *buf = allocator<T>::allocate(2 * n);
+			T *p = buf;
+			for (;first1 != last1;++first1, ++p)
+				*p = *first1;
+			for (;first2 != last2;++first2, ++p)
+				*p = *first2;
+			miniSTL::radix_sort(buf, buf + n);
+			miniSTL::radix_sort(buf + n, buf + 2 * n);
+			bool result = miniSTL::equal(buf, buf + n, buf + n);
+			allocator<T>::deallocate(buf, 2 * n);
+			return result;
 		}
 	}
 
-	template <typename InputIterator,typename Distance>
-	void advance(InputIterator &it, Distance n)
+	template <typename ForwardIterator1,typename ForwardIterator2,typename BinaryPredicate>
+	bool is_permutation(ForwardIterator1 first1, ForwardIterator1 last1,
+		ForwardIterator2 first2, BinaryPredicate pred)
 	{
-		typedef iterator_traits<InputIterator>::iterator_category iterator_category;
-		_advance(it, n, iterator_category());
+		auto res = miniSTL::mismatch(first1, last1, first2, pred);
+		first1 = res.first, first2 = res.second;
+		if (first1 == last1)
+			return true;
+		auto last2 = first2;
+		miniSTL::advance(last2, miniSTL::distance(first1, last1));
+		return _is_permutation_count(first1, last1, first2, last2, pred);
+	}
+
+	template <typename ForwardIterator1,typename ForwardIterator2>
+	bool is_permutation(ForwardIterator1 first1, ForwardIterator1 last1, ForwardIterator2 first2)
+	{
+		auto res = miniSTL::mismatch(first1, last1, first2);
+		first1 = res.first, first2 = res.second;
+		if (first1 == last1)
+			return true;
+		auto last2 = first2;
+		miniSTL::advance(last2, miniSTL::distance(first1, last1));
+		typedef typename _is_permutation_sortable<ForwardIterator1, ForwardIterator2>::type is_sortable;
+		return _is_permutation_aux(first1, last1, first2, last2, is_sortable());
 	}
 
 	/*
-	* sort
-	* O(NlogN)
-	* ÿ㷨
+	* includes / set_union / set_intersection / set_difference / set_symmetric_difference
+	* O(N+M)
+	* 䶼 comp 򣬿ԺظԪأֵ x ߷ֱ mn ʱ
+	*  max(m,n) Σ min(m,n) Σ max(m-n,0) ΣԳƲ |m-n| 
+	* ȵԪȡԵһ䣬result ص
+	* includes  set_intersection 䶼ʵҳ SET_GALLOP_RATIO ʱ
+	* ԶÿԪشӳϴͣµλÿʼָңgallopingO(MlogN/M)M Ϊĳ
+	* set_intersection  uint32_t 顢ʹĬϱȽҳʱ simd::intersect_sorted_u32
 	*/
+	template <typename InputIterator1,typename InputIterator2>
+	struct _is_random_access_pair
+	{
+		static const bool value =
+			std::is_same<typename iterator_traits<InputIterator1>::iterator_category, random_access_iterator_tag>::value &&
+			std::is_same<typename iterator_traits<InputIterator2>::iterator_category, random_access_iterator_tag>::value;
+		typedef typename FirstOrSecond<value, _true_type, _false_type>::result type;
+	};
+
+	template <typename InputIterator1,typename InputIterator2,typename OutputIterator>
+	struct _is_simd_intersectable
+	{
+		typedef typename std::remove_cv<typename std::remove_pointer<InputIterator1>::type>::type value_type1;
+		typedef typename std::remove_cv<typename std::remove_pointer<InputIterator2>::type>::type value_type2;
+		static const bool value = std::is_pointer<InputIterator1>::value && std::is_pointer<InputIterator2>::value &&
+			std::is_same<value_type1, uint32_t>::value && std::is_same<value_type2, uint32_t>::value &&
+			std::is_same<OutputIterator, uint32_t*>::value;
+		typedef typename FirstOrSecond<value, _true_type, _false_type>::result type;
+	};
+
 	namespace
 	{
-		// [first,last]
-		template <typename RandomIterator,typename BinaryPredicate>
-		typename iterator_traits<RandomIterator>::value_type
-			mid3(RandomIterator first, RandomIterator last, BinaryPredicate pred)
+		enum { SET_GALLOP_RATIO = 32 };
+
+		template <typename InputIterator1,typename InputIterator2,typename Compare>
+		bool _includes_aux(InputIterator1 first1, InputIterator1 last1,
+			InputIterator2 first2, InputIterator2 last2, Compare &comp, _false_type)
 		{
-			auto mid = first + (last + 1 - first) / 2;
-			if (pred(*mid, *first))
+			for (;first2 != last2;++first1)
 			{
-				swap(*mid, *first);
+				if (first1 == last1 || comp(*first2, *first1))
+					return false;
+				if (!comp(*first1, *first2))
+					++first2;
 			}
-			if (pred(*last, *mid))
+			return true;
+		}
+
+		template <typename RandomIterator1,typename RandomIterator2,typename Compare>
+		bool _includes_aux(RandomIterator1 first1, RandomIterator1 last1,
+			RandomIterator2 first2, RandomIterator2 last2, Compare &comp, _true_type)
+		{
+			auto len1 = last1 - first1;
+			auto len2 = last2 - first2;
+			// ڶÿԪضҪӦһеһԪ
+			if (len2 > len1)
+				return false;
+			if (len1 / SET_GALLOP_RATIO < len2)
+				return _includes_aux(first1, last1, first2, last2, comp, _false_type());
+			for (;first2 != last2;++first2)
 			{
-				swap(*last, *mid);
+				auto skip = gallop(*first2, first1, len1, false, false, comp);
+				first1 += skip;
+				len1 -= skip;
+				if (len1 == 0 || comp(*first2, *first1))
+					return false;
+				++first1;
+				--len1;
 			}
-			if (pred(*last, *first))
+			return true;
+		}
+
+		template <typename InputIterator1,typename InputIterator2,typename OutputIterator,typename Compare>
+		OutputIterator _set_intersection_aux(InputIterator1 first1, InputIterator1 last1,
+			InputIterator2 first2, InputIterator2 last2, OutputIterator result, Compare &comp, _false_type)
+		{
+			while (first1 != last1 && first2 != last2)
 			{
-				swap(*last, *first);
+				if (comp(*first1, *first2))
+				{
+					++first1;
+				}
+				else if (comp(*first2, *first1))
+				{
+					++first2;
+				}
+				else
+				{
+					*result = *first1;
+					++result;
+					++first1;
+					++first2;
+				}
 			}
-			auto ret = *mid;
-			swap(*mid, *(last - 1));
-			return ret;
+			return result;
 		}
 
-		template <typename RandomIterator,typename BinaryPredicate>
-		void bubble_sort(RandomIterator first, RandomIterator last, BinaryPredicate pred)
+		template <typename RandomIterator1,typename RandomIterator2,typename OutputIterator,typename Compare>
+		OutputIterator _set_intersection_aux(RandomIterator1 first1, RandomIterator1 last1,
+			RandomIterator2 first2, RandomIterator2 last2, OutputIterator result, Compare &comp, _true_type)
 		{
-			auto len = last - first;
-			for (auto i = len;i != 0;--i)
+			auto len1 = last1 - first1;
+			auto len2 = last2 - first2;
+			if (len1 / SET_GALLOP_RATIO >= len2)
 			{
-				bool swaped = false;
-				for (auto p = first;p != (first + i - 1);++p)
+				// ڶ̣ڵһв
+				for (;first2 != last2 && len1 != 0;++first2)
 				{
-					if (pred(*(p + 1), *p))
+					auto skip = gallop(*first2, first1, len1, false, false, comp);
+					first1 += skip;
+					len1 -= skip;
+					if (len1 != 0 && !comp(*first2, *first1))
 					{
-						swap(*(p + 1), *p);
-						swaped = true;
+						*result = *first1;
+						++result;
+						++first1;
+						--len1;
 					}
 				}
-				if (!swaped)
-					break;
+				return result;
+			}
+			if (len2 / SET_GALLOP_RATIO >= len1)
+			{
+				// һ̣ڵڶв
+				for (;first1 != last1 && len2 != 0;++first1)
+				{
+					auto skip = gallop(*first1, first2, len2, false, false, comp);
+					first2 += skip;
+					len2 -= skip;
+					if (len2 != 0 && !comp(*first1, *first2))
+					{
+						*result = *first1;
+						++result;
+						++first2;
+						--len2;
+					}
+				}
+				return result;
 			}
+			return _set_intersection_aux(first1, last1, first2, last2, result, comp, _false_type());
 		}
-	}
 
-	template <typename RandomIterator,typename BinaryPredicate>
-	void sort(RandomIterator first, RandomIterator last, BinaryPredicate pred)
-	{
-		if (first >= last || first + 1 == last)
-			return;
-		if (last - first <= 20)//䳤Сڵ20ð
+		template <typename InputIterator1,typename InputIterator2,typename OutputIterator>
+		OutputIterator _set_intersection_default(InputIterator1 first1, InputIterator1 last1,
+			InputIterator2 first2, InputIterator2 last2, OutputIterator result, _false_type)
 		{
-			bubble_sort(first, last, pred);
-			return;
+			less<typename iterator_traits<InputIterator1>::value_type> comp;
+			typedef typename _is_random_access_pair<InputIterator1, InputIterator2>::type is_random_access;
+			return _set_intersection_aux(first1, last1, first2, last2, result, comp, is_random_access());
 		}
 
-		auto mid = mid3(first, last - 1, pred);
-		auto p1 = first, p2 = last - 2;
-		while (p1 < p2)
+		template <typename Pointer1,typename Pointer2>
+		uint32_t *_set_intersection_default(Pointer1 first1, Pointer1 last1,
+			Pointer2 first2, Pointer2 last2, uint32_t *result, _true_type)
 		{
-			while (pred(*p1, mid) && (p1 < p2))
-				++p1;
-			while (!pred(*p2, mid) && (p1 < p2))
-				--p2;
-			if (p1 < p2)
-				swap(*p1, *p2);
+			const size_t len1 = last1 - first1, len2 = last2 - first2;
+			if (len1 / SET_GALLOP_RATIO >= len2 || len2 / SET_GALLOP_RATIO >= len1)
+				return _set_intersection_default(first1, last1, first2, last2, result, _false_type());
+			return result + simd::intersect_sorted_u32(first1, len1, first2, len2, result);
 		}
-		swap(*p1, *(last - 2));
-		sort(first, p1, pred);
-		sort(p1 + 1, last, pred);
 	}
 
-	template <typename RandomIterator>
-	void sort(RandomIterator first, RandomIterator last)
+	template <typename InputIterator1,typename InputIterator2,typename Compare>
+	bool includes(InputIterator1 first1, InputIterator1 last1,
+		InputIterator2 first2, InputIterator2 last2, Compare comp)
 	{
-		return sort(first, last, less<typename iteratr_traits<RandomIterator>::value_type>());
+		typedef typename _is_random_access_pair<InputIterator1, InputIterator2>::type is_random_access;
+		return _includes_aux(first1, last1, first2, last2, comp, is_random_access());
 	}
 
-	/*
-	* generate
-	* O(N)
-	*/
-	template <typename InputIterator,typename Function>
-	void generate(InputIterator first, InputIterator last, Function fn)
+	template <typename InputIterator1,typename InputIterator2>
+	bool includes(InputIterator1 first1, InputIterator1 last1,
+		InputIterator2 first2, InputIterator2 last2)
 	{
-		for (;first != last;++first)
-		{
-			*first = fn();
-		}
+		return miniSTL::includes(first1, last1, first2, last2,
+			less<typename iterator_traits<InputIterator1>::value_type>());
 	}
 
-	/*
-	* generate_n
-	* O(N)
-	*/
-	template <typename OutputIterator,typename Size,typename Generator>
-	void generate_n(OutputIterator first, Size n, Generator gen)
+	template <typename InputIterator1,typename InputIterator2,typename OutputIterator,typename Compare>
+	OutputIterator set_union(InputIterator1 first1, InputIterator1 last1,
+		InputIterator2 first2, InputIterator2 last2, OutputIterator result, Compare comp)
 	{
-		while (n--)
+		while (first1 != last1 && first2 != last2)
 		{
-			*first = gen();
-			++first;
+			if (comp(*first1, *first2))
+			{
+				*result = *first1;
+				++first1;
+			}
+			else if (comp(*first2, *first1))
+			{
+				*result = *first2;
+				++first2;
+			}
+			else
+			{
+				*result = *first1;
+				++first1;
+				++first2;
+			}
+			++result;
 		}
+		for (;first1 != last1;++first1, ++result)
+			*result = *first1;
+		for (;first2 != last2;++first2, ++result)
+			*result = *first2;
+		return result;
 	}
 
-	/*
-	* Distance
-	* O(N)
-	*/
-	template <typename InputIterator>
-	typename iterator_traits<InputIterator>::difference_type
-		_distance(InputIterator first, InputIterator last, input_iterator_tag)
+	template <typename InputIterator1,typename InputIterator2,typename OutputIterator>
+	OutputIterator set_union(InputIterator1 first1, InputIterator1 last1,
+		InputIterator2 first2, InputIterator2 last2, OutputIterator result)
 	{
-		typename iterator_traits<InputIterator>::difference_type dist = 0;
-		while (first++ != last)
+		return miniSTL::set_union(first1, last1, first2, last2, result,
+			less<typename iterator_traits<InputIterator1>::value_type>());
+	}
+
+	template <typename InputIterator1,typename InputIterator2,typename OutputIterator,typename Compare>
+	OutputIterator set_intersection(InputIterator1 first1, InputIterator1 last1,
+		InputIterator2 first2, InputIterator2 last2, OutputIterator result, Compare comp)
+	{
+		typedef typename _is_random_access_pair<InputIterator1, InputIterator2>::type is_random_access;
+		return _set_intersection_aux(first1, last1, first2, last2, result, comp, is_random_access());
+	}
+
+	template <typename InputIterator1,typename InputIterator2,typename OutputIterator>
+	OutputIterator set_intersection(InputIterator1 first1, InputIterator1 last1,
+		InputIterator2 first2, InputIterator2 last2, OutputIterator result)
+	{
+		typedef typename _is_simd_intersectable<InputIterator1, InputIterator2, OutputIterator>::type is_simd;
+		return _set_intersection_default(first1, last1, first2, last2, result, is_simd());
+	}
+
+	template <typename InputIterator1,typename InputIterator2,typename OutputIterator,typename Compare>
+	OutputIterator set_difference(InputIterator1 first1, InputIterator1 last1,
+		InputIterator2 first2, InputIterator2 last2, OutputIterator result, Compare comp)
+	{
+		while (first1 != last1 && first2 != last2)
 		{
-			++dist;
+			if (comp(*first1, *first2))
+			{
+				*result = *first1;
+				++result;
+				++first1;
+			}
+			else if (comp(*first2, *first1))
+			{
+				++first2;
+			}
+			else
+			{
+				++first1;
+				++first2;
+			}
 		}
-		return dist;
+		for (;first1 != last1;++first1, ++result)
+			*result = *first1;
+		return result;
 	}
 
-	template <typename RandomIterator>
-	typename iterator_traits<RandomIterator>::difference_type
-		_distance(RandomIterator first, RandomIterator last, random_access_iterator_tag)
+	template <typename InputIterator1,typename InputIterator2,typename OutputIterator>
+	OutputIterator set_difference(InputIterator1 first1, InputIterator1 last1,
+		InputIterator2 first2, InputIterator2 last2, OutputIterator result)
 	{
-		auto dist = last - first;
-		return dist;
+		return miniSTL::set_difference(first1, last1, first2, last2, result,
+			less<typename iterator_traits<InputIterator1>::value_type>());
 	}
 
-	template <typename Iterator>
-	typename iterator_traits<Iterator>::difference_type
-		distance(Iterator first, Iterator last)
+	template <typename InputIterator1,typename InputIterator2,typename OutputIterator,typename Compare>
+	OutputIterator set_symmetric_difference(InputIterator1 first1, InputIterator1 last1,
+		InputIterator2 first2, InputIterator2 last2, OutputIterator result, Compare comp)
 	{
-		typedef typename iterator_traits<Iterator>::iterator_category iterator_category;
-		return _distance(first, last, iterator_category());
+		while (first1 != last1 && first2 != last2)
+		{
+			if (comp(*first1, *first2))
+			{
+				*result = *first1;
+				++result;
+				++first1;
+			}
+			else if (comp(*first2, *first1))
+			{
+				*result = *first2;
+				++result;
+				++first2;
+			}
+			else
+			{
+				++first1;
+				++first2;
+			}
+		}
+		for (;first1 != last1;++first1, ++result)
+			*result = *first1;
+		for (;first2 != last2;++first2, ++result)
+			*result = *first2;
+		return result;
+	}
+
+	template <typename InputIterator1,typename InputIterator2,typename OutputIterator>
+	OutputIterator set_symmetric_difference(InputIterator1 first1, InputIterator1 last1,
+		InputIterator2 first2, InputIterator2 last2, OutputIterator result)
+	{
+		return miniSTL::set_symmetric_difference(first1, last1, first2, last2, result,
+			less<typename iterator_traits<InputIterator1>::value_type>());
 	}
 
 	/*
@@ -844,7 +3260,8 @@ namespace miniSTL
 	inline T *__copy_t(const T *first, const T *last, T *result,
 		_true_type)
 	{
-		memmove(result, first, sizeof(T) * (last - first));
+		if (first != last)
+			memmove(result, first, sizeof(T) * (last - first));
 		return result + (last - first);
 	}
 
@@ -861,8 +3278,8 @@ namespace miniSTL
 	{
 		T *operator()(T *first, T *last, T *result)
 		{
-			typedef typename _type_traits<T>::is_POD_type is_pod;
-			return __copy_t(first, last, result, is_pod());
+			typedef typename _type_traits<T>::has_trivial_assignment_operator trivial_assign;
+			return __copy_t(first, last, result, trivial_assign());
 		}
 	};
 
@@ -871,8 +3288,8 @@ namespace miniSTL
 	{
 		T *operator()(const T *first, const T *last, T *result)
 		{
-			typedef typename _type_traits<T>::is_POD_type is_pod;
-			return __copy_t(first, last, result, is_pod());
+			typedef typename _type_traits<T>::has_trivial_assignment_operator trivial_assign;
+			return __copy_t(first, last, result, trivial_assign());
 		}
 	};
 
@@ -913,6 +3330,58 @@ namespace miniSTL
 		return __copy_dispatch<InputIterator, OutputIterator>()
 			(first, last, result);
 	}
+
+	/*
+	* ָͬһֿƽֵ͵ԭָʱΪ _true_type
+	* ʱ memmove ֵ
+	*/
+	template <typename Iterator1,typename Iterator2>
+	struct _is_trivially_copyable_pointers
+	{
+		typedef typename std::remove_cv<typename std::remove_pointer<Iterator1>::type>::type value_type1;
+		typedef typename std::remove_pointer<Iterator2>::type value_type2;
+		static const bool value = std::is_pointer<Iterator1>::value && std::is_pointer<Iterator2>::value &&
+			std::is_same<value_type1, value_type2>::value &&
+			std::is_same<typename _type_traits<value_type2>::has_trivial_assignment_operator, _true_type>::value;
+		typedef typename FirstOrSecond<value, _true_type, _false_type>::result type;
+	};
+
+	namespace
+	{
+		template <typename BidirectionalIterator1,typename BidirectionalIterator2>
+		BidirectionalIterator2 _copy_backward_aux(BidirectionalIterator1 first, BidirectionalIterator1 last,
+			BidirectionalIterator2 result, _false_type)
+		{
+			while (first != last)
+				*--result = *--last;
+			return result;
+		}
+
+		template <typename Pointer1,typename Pointer2>
+		Pointer2 _copy_backward_aux(Pointer1 first, Pointer1 last, Pointer2 result, _true_type)
+		{
+			typedef typename std::remove_pointer<Pointer2>::type value_type;
+			ptrdiff_t n = last - first;
+			result -= n;
+			if (n != 0)
+				memmove(result, first, n * sizeof(value_type));
+			return result;
+		}
+	}
+
+	/*
+	* copy_backward()
+	* O(N)
+	*  [first,last) Ƶ result β䣬Ӻǰֵ
+	* ĿԴĺ벿صĿ
+	*/
+	template <typename BidirectionalIterator1,typename BidirectionalIterator2>
+	inline BidirectionalIterator2 copy_backward(BidirectionalIterator1 first, BidirectionalIterator1 last,
+		BidirectionalIterator2 result)
+	{
+		typedef typename _is_trivially_copyable_pointers<BidirectionalIterator1, BidirectionalIterator2>::type is_trivial;
+		return _copy_backward_aux(first, last, result, is_trivial());
+	}
 }
 
 
@@ -3,8 +3,32 @@
 */
 #include "mini_alloc.h"
 
+#include <atomic>
+#include <thread>
+
 namespace miniSTL
 {
+	namespace
+	{
+		std::atomic_flag alloc_lock = ATOMIC_FLAG_INIT;
+
+		//  free list ڴصֻвڴʱŻڳڼ malloc()
+		class alloc_guard
+		{
+		public:
+			alloc_guard()
+			{
+				while (alloc_lock.test_and_set(std::memory_order_acquire))
+					std::this_thread::yield();
+			}
+
+			~alloc_guard() { alloc_lock.clear(std::memory_order_release); }
+
+			alloc_guard(const alloc_guard&) = delete;
+			alloc_guard &operator=(const alloc_guard&) = delete;
+		};
+	}
+
 	char *_alloc::_start_free = nullptr;
 	char *_alloc::_end_free = nullptr;
 	size_t _alloc::_heap_size = 0;
@@ -19,6 +43,7 @@ namespace miniSTL
 			return malloc(_round_up(bytes));
 		}
 
+		alloc_guard guard;
 		size_t index = _FREELIST_INDEX(bytes);
 		obj *list = _free_lists[index];
 		if (list == 0)
@@ -44,6 +69,7 @@ namespace miniSTL
 		else
 		{
 			// free list,ջ
+			alloc_guard guard;
 			size_t index = _FREELIST_INDEX(bytes);
 			obj *node = static_cast<obj*>(ptr);
 			node->next = _free_lists[index];
@@ -9,6 +9,8 @@ namespace miniSTL
 	/*
 	* ԶĿռ
 	* ΪĿʵֵṩڴ
+	* С free list ڴһڶ߳ͬʱʹ
+	* ٽֻмָȻС
 	* ûһ㲻Ӧֱʹ
 	* οϣSTLԴby 
 	*/
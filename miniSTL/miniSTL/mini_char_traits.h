@@ -0,0 +1,119 @@
+#ifndef _CHAR_TRAITS_H
+#define _CHAR_TRAITS_H
+
+#include "mini_simd.h"
+
+#include <cstddef>
+#include <cstring>
+
+namespace miniSTL
+{
+	/*
+	* ַԣ basic_string  basic_string_view ʹ
+	* ӿ std::char_traits ַõӼ
+	* ַ;ɰλȽϣ˿Ƚͳһ memcpy/memmove  SIMD
+	* char ػʹ strlenmemchrmemset
+	*/
+	template <typename CharT>
+	struct char_traits
+	{
+		typedef CharT char_type;
+
+		static bool eq(char_type a, char_type b) { return a == b; }
+		static bool lt(char_type a, char_type b) { return a < b; }
+		static void assign(char_type &r, const char_type &c) { r = c; }
+
+		static size_t length(const char_type *s)
+		{
+			const char_type *p = s;
+			while (*p != char_type())
+				++p;
+			return static_cast<size_t>(p - s);
+		}
+
+		// ȰֽҵһַͬٱȽһַ
+		static int compare(const char_type *s1, const char_type *s2, size_t n)
+		{
+			size_t i = simd::mismatch_bytes(s1, s2, n * sizeof(char_type)) / sizeof(char_type);
+			if (i == n)
+				return 0;
+			return lt(s1[i], s2[i]) ? -1 : 1;
+		}
+
+		static const char_type *find(const char_type *s, size_t n, const char_type &c)
+		{
+			const char_type *p = simd::find_unit(s, s + n, c);
+			return p == s + n ? nullptr : p;
+		}
+
+		static char_type *copy(char_type *dest, const char_type *src, size_t n)
+		{
+			if (n != 0)
+				memcpy(dest, src, n * sizeof(char_type));
+			return dest;
+		}
+
+		static char_type *move(char_type *dest, const char_type *src, size_t n)
+		{
+			if (n != 0)
+				memmove(dest, src, n * sizeof(char_type));
+			return dest;
+		}
+
+		static char_type *assign(char_type *dest, size_t n, char_type c)
+		{
+			for (size_t i = 0;i != n;++i)
+				dest[i] = c;
+			return dest;
+		}
+	};
+
+	template <>
+	struct char_traits<char>
+	{
+		typedef char char_type;
+
+		static bool eq(char a, char b) { return a == b; }
+		//  memcmp һ£ unsigned char Ƚ
+		static bool lt(char a, char b) { return static_cast<unsigned char>(a) < static_cast<unsigned char>(b); }
+		static void assign(char &r, const char &c) { r = c; }
+
+		static size_t length(const char *s) { return strlen(s); }
+
+		static int compare(const char *s1, const char *s2, size_t n)
+		{
+			size_t i = simd::mismatch_bytes(s1, s2, n);
+			if (i == n)
+				return 0;
+			return lt(s1[i], s2[i]) ? -1 : 1;
+		}
+
+		static const char *find(const char *s, size_t n, const char &c)
+		{
+			return n == 0 ? nullptr : static_cast<const char*>(memchr(s, c, n));
+		}
+
+		static char *copy(char *dest, const char *src, size_t n)
+		{
+			if (n != 0)
+				memcpy(dest, src, n);
+			return dest;
+		}
+
+		static char *move(char *dest, const char *src, size_t n)
+		{
+			if (n != 0)
+				memmove(dest, src, n);
+			return dest;
+		}
+
+		static char *assign(char *dest, size_t n, char c)
+		{
+			if (n != 0)
+				memset(dest, static_cast<unsigned char>(c), n);
+			return dest;
+		}
+	};
+}
+
+#endif
@@ -0,0 +1,956 @@
+/*
+* ļʵ ַĻת
+*/
+#include "mini_charconv.h"
+#include "mini_hash.h"
+
+#include <cassert>
+#include <cmath>
+#include <cctype>
+#include <cstring>
+
+namespace miniSTL
+{
+	namespace
+	{
+		/*
+		* Grisu3Florian Loitsch, "Printing Floating-Point Numbers Quickly and Accurately with Integers"
+		*  64 λģĸ diyfp λڡλٵʮִ
+		* ͬʱ diyfp ޷ȷӽԭֵʱʧܣԼ 0.5% 룩
+		* ʱôľȷ㷨 shortest_exactĽܻԭԭֵӽıʾ
+		*/
+		struct diyfp
+		{
+			uint64_t f;
+			int e;
+
+			diyfp(uint64_t f_, int e_) :f(f_), e(e_) {}
+		};
+
+		inline diyfp sub(const diyfp &x, const diyfp &y)
+		{
+			return diyfp(x.f - y.f, x.e);
+		}
+
+		// ȡ 128 λ˻ĸ 64 λ
+		inline diyfp mul(const diyfp &x, const diyfp &y)
+		{
+			uint64_t lo = x.f, hi = y.f;
+			hash_detail::mum(lo, hi);
+			return diyfp(hi + (lo >> 63), x.e + y.e + 64);
+		}
+
+		inline diyfp normalize(diyfp x)
+		{
+			while ((x.f >> 63) == 0)
+			{
+				x.f <<= 1;
+				--x.e;
+			}
+			return x;
+		}
+
+		inline diyfp normalize_to(const diyfp &x, int target_e)
+		{
+			return diyfp(x.f << (x.e - target_e), target_e);
+		}
+
+		struct boundaries
+		{
+			diyfp w, minus, plus;
+		};
+
+		//  valueֵ±߽ m-m+ָͬ
+		template<typename F>
+		boundaries compute_boundaries(F value)
+		{
+			typedef typename std::conditional<sizeof(F) == 8, uint64_t, uint32_t>::type bits_type;
+			const int precision = std::numeric_limits<F>::digits;
+			const int bias = std::numeric_limits<F>::max_exponent - 1 + (precision - 1);
+			const int min_exp = 1 - bias;
+			const uint64_t hidden_bit = uint64_t(1) << (precision - 1);
+
+			bits_type bits;
+			memcpy(&bits, &value, sizeof(bits));
+			const uint64_t E = bits >> (precision - 1);
+			const uint64_t M = bits & (hidden_bit - 1);
+
+			const diyfp v = E == 0 ? diyfp(M, min_exp) : diyfp(M + hidden_bit, static_cast<int>(E) - bias);
+			// ЧλΪ 0 ʱ±߽ value 
+			const bool lower_closer = M == 0 && E > 1;
+			const diyfp m_plus(2 * v.f + 1, v.e - 1);
+			const diyfp m_minus = lower_closer ? diyfp(4 * v.f - 1, v.e - 2) : diyfp(2 * v.f - 1, v.e - 1);
+
+			const diyfp w_plus = normalize(m_plus);
+			const diyfp w_minus = normalize_to(m_minus, w_plus.e);
+			boundaries b = { normalize(v), w_minus, w_plus };
+			return b;
+		}
+
+		//  c = 10^-k ˺ʹ m+ Ķָ [ALPHA, GAMMA] ֮
+		enum _EGRISU { ALPHA = -60, GAMMA = -32 };
+
+		struct cached_power
+		{
+			uint64_t f;
+			int e;
+			int k;
+		};
+
+		// 10^-300  10^324Ϊ 8 Ĺ 64 λֵ
+		static const int CACHED_POWERS_MIN_DEC_EXP = -300;
+		static const int CACHED_POWERS_DEC_STEP = 8;
+		static const cached_power cached_powers[] =
+		{
+			{ 0xAB70FE17C79AC6CAULL, -1060, -300 },
+			{ 0xFF77B1FCBEBCDC4FULL, -1034, -292 },
+			{ 0xBE5691EF416BD60CULL, -1007, -284 },
+			{ 0x8DD01FAD907FFC3CULL, -980, -276 },
+			{ 0xD3515C2831559A83ULL, -954, -268 },
+			{ 0x9D71AC8FADA6C9B5ULL, -927, -260 },
+			{ 0xEA9C227723EE8BCBULL, -901, -252 },
+			{ 0xAECC49914078536DULL, -874, -244 },
+			{ 0x823C12795DB6CE57ULL, -847, -236 },
+			{ 0xC21094364DFB5637ULL, -821, -228 },
+			{ 0x9096EA6F3848984FULL, -794, -220 },
+			{ 0xD77485CB25823AC7ULL, -768, -212 },
+			{ 0xA086CFCD97BF97F4ULL, -741, -204 },
+			{ 0xEF340A98172AACE5ULL, -715, -196 },
+			{ 0xB23867FB2A35B28EULL, -688, -188 },
+			{ 0x84C8D4DFD2C63F3BULL, -661, -180 },
+			{ 0xC5DD44271AD3CDBAULL, -635, -172 },
+			{ 0x936B9FCEBB25C996ULL, -608, -164 },
+			{ 0xDBAC6C247D62A584ULL, -582, -156 },
+			{ 0xA3AB66580D5FDAF6ULL, -555, -148 },
+			{ 0xF3E2F893DEC3F126ULL, -529, -140 },
+			{ 0xB5B5ADA8AAFF80B8ULL, -502, -132 },
+			{ 0x87625F056C7C4A8BULL, -475, -124 },
+			{ 0xC9BCFF6034C13053ULL, -449, -116 },
+			{ 0x964E858C91BA2655ULL, -422, -108 },
+			{ 0xDFF9772470297EBDULL, -396, -100 },
+			{ 0xA6DFBD9FB8E5B88FULL, -369, -92 },
+			{ 0xF8A95FCF88747D94ULL, -343, -84 },
+			{ 0xB94470938FA89BCFULL, -316, -76 },
+			{ 0x8A08F0F8BF0F156BULL, -289, -68 },
+			{ 0xCDB02555653131B6ULL, -263, -60 },
+			{ 0x993FE2C6D07B7FACULL, -236, -52 },
+			{ 0xE45C10C42A2B3B06ULL, -210, -44 },
+			{ 0xAA242499697392D3ULL, -183, -36 },
+			{ 0xFD87B5F28300CA0EULL, -157, -28 },
+			{ 0xBCE5086492111AEBULL, -130, -20 },
+			{ 0x8CBCCC096F5088CCULL, -103, -12 },
+			{ 0xD1B71758E219652CULL, -77, -4 },
+			{ 0x9C40000000000000ULL, -50, 4 },
+			{ 0xE8D4A51000000000ULL, -24, 12 },
+			{ 0xAD78EBC5AC620000ULL, 3, 20 },
+			{ 0x813F3978F8940984ULL, 30, 28 },
+			{ 0xC097CE7BC90715B3ULL, 56, 36 },
+			{ 0x8F7E32CE7BEA5C70ULL, 83, 44 },
+			{ 0xD5D238A4ABE98068ULL, 109, 52 },
+			{ 0x9F4F2726179A2245ULL, 136, 60 },
+			{ 0xED63A231D4C4FB27ULL, 162, 68 },
+			{ 0xB0DE65388CC8ADA8ULL, 189, 76 },
+			{ 0x83C7088E1AAB65DBULL, 216, 84 },
+			{ 0xC45D1DF942711D9AULL, 242, 92 },
+			{ 0x924D692CA61BE758ULL, 269, 100 },
+			{ 0xDA01EE641A708DEAULL, 295, 108 },
+			{ 0xA26DA3999AEF774AULL, 322, 116 },
+			{ 0xF209787BB47D6B85ULL, 348, 124 },
+			{ 0xB454E4A179DD1877ULL, 375, 132 },
+			{ 0x865B86925B9BC5C2ULL, 402, 140 },
+			{ 0xC83553C5C8965D3DULL, 428, 148 },
+			{ 0x952AB45CFA97A0B3ULL, 455, 156 },
+			{ 0xDE469FBD99A05FE3ULL, 481, 164 },
+			{ 0xA59BC234DB398C25ULL, 508, 172 },
+			{ 0xF6C69A72A3989F5CULL, 534, 180 },
+			{ 0xB7DCBF5354E9BECEULL, 561, 188 },
+			{ 0x88FCF317F22241E2ULL, 588, 196 },
+			{ 0xCC20CE9BD35C78A5ULL, 614, 204 },
+			{ 0x98165AF37B2153DFULL, 641, 212 },
+			{ 0xE2A0B5DC971F303AULL, 667, 220 },
+			{ 0xA8D9D1535CE3B396ULL, 694, 228 },
+			{ 0xFB9B7CD9A4A7443CULL, 720, 236 },
+			{ 0xBB764C4CA7A44410ULL, 747, 244 },
+			{ 0x8BAB8EEFB6409C1AULL, 774, 252 },
+			{ 0xD01FEF10A657842CULL, 800, 260 },
+			{ 0x9B10A4E5E9913129ULL, 827, 268 },
+			{ 0xE7109BFBA19C0C9DULL, 853, 276 },
+			{ 0xAC2820D9623BF429ULL, 880, 284 },
+			{ 0x80444B5E7AA7CF85ULL, 907, 292 },
+			{ 0xBF21E44003ACDD2DULL, 933, 300 },
+			{ 0x8E679C2F5E44FF8FULL, 960, 308 },
+			{ 0xD433179D9C8CB841ULL, 986, 316 },
+			{ 0x9E19DB92B4E31BA9ULL, 1013, 324 },
+		};
+
+		cached_power get_cached_power_for_binary_exponent(int e)
+		{
+			// k = ceil((ALPHA - e - 1) * log10(2))78913 / 2^18  log10(2) Ľֵ
+			const int f = ALPHA - e - 1;
+			const int k = (f * 78913) / (1 << 18) + (f > 0);
+			const int index = (-CACHED_POWERS_MIN_DEC_EXP + k + (CACHED_POWERS_DEC_STEP - 1)) / CACHED_POWERS_DEC_STEP;
+			return cached_powers[index];
+		}
+
+		//  n ʮλpow10 Ϊ 10^(λ-1)
+		inline int find_largest_pow10(uint32_t n, uint32_t &pow10)
+		{
+			static const uint32_t pows[] = { 1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000 };
+			int i = 9;
+			while (i > 0 && n < pows[i])
+				--i;
+			pow10 = pows[i];
+			return i + 1;
+		}
+
+		/*
+		* һλӽ ww  unit dist  too_high  w ľ
+		* Χ޷ȷĸӽ w߽ܲʵʱ false
+		*/
+		bool grisu3_round_weed(char *buf, int len, uint64_t dist, uint64_t unsafe,
+			uint64_t rest, uint64_t ten_k, uint64_t unit)
+		{
+			const uint64_t small_dist = dist - unit;
+			const uint64_t big_dist = dist + unit;
+			while (rest < small_dist && unsafe - rest >= ten_k
+				&& (rest + ten_k < small_dist || small_dist - rest >= rest + ten_k - small_dist))
+			{
+				--buf[len - 1];
+				rest += ten_k;
+			}
+			//  w һ˼㻹ܸӽ˵ֶӽ
+			if (rest < big_dist && unsafe - rest >= ten_k
+				&& (rest + ten_k < big_dist || big_dist - rest > rest + ten_k - big_dist))
+				return false;
+			return 2 * unit <= rest && rest <= unsafe - 4 * unit;
+		}
+
+		bool grisu3_digit_gen(char *buf, int &len, int &decimal_exponent, diyfp low, diyfp w, diyfp high)
+		{
+			// lowwhigh  1 λſõһʵĲȫ
+			uint64_t unit = 1;
+			const diyfp too_low(low.f - unit, low.e);
+			const diyfp too_high(high.f + unit, high.e);
+			diyfp unsafe = sub(too_high, too_low);
+			const diyfp one(uint64_t(1) << -w.e, w.e);
+
+			uint32_t p1 = static_cast<uint32_t>(too_high.f >> -one.e);//
+			uint64_t p2 = too_high.f & (one.f - 1);//С
+
+			uint32_t pow10;
+			int n = find_largest_pow10(p1, pow10);
+			while (n > 0)
+			{
+				const uint32_t d = p1 / pow10;
+				p1 %= pow10;
+				buf[len++] = static_cast<char>('0' + d);
+				--n;
+				const uint64_t rest = (static_cast<uint64_t>(p1) << -one.e) + p2;
+				if (rest < unsafe.f)
+				{
+					decimal_exponent += n;
+					return grisu3_round_weed(buf, len, sub(too_high, w).f, unsafe.f, rest,
+						static_cast<uint64_t>(pow10) << -one.e, unit);
+				}
+				pow10 /= 10;
+			}
+
+			for (;;)
+			{
+				p2 *= 10;
+				unit *= 10;
+				unsafe.f *= 10;
+				const uint64_t d = p2 >> -one.e;
+				p2 &= one.f - 1;
+				buf[len++] = static_cast<char>('0' + d);
+				--decimal_exponent;
+				if (p2 < unsafe.f)
+					return grisu3_round_weed(buf, len, sub(too_high, w).f * unit, unsafe.f, p2, one.f, unit);
+			}
+		}
+
+		//  value ʮִvalue = buf[0, len) * 10^decimal_exponentʧʱ false
+		template<typename F>
+		bool grisu3(char *buf, int &len, int &decimal_exponent, F value)
+		{
+			const boundaries b = compute_boundaries(value);
+			const cached_power cached = get_cached_power_for_binary_exponent(b.plus.e);
+			const diyfp c_minus_k(cached.f, cached.e);
+
+			const diyfp w = mul(b.w, c_minus_k);
+			const diyfp w_minus = mul(b.minus, c_minus_k);
+			const diyfp w_plus = mul(b.plus, c_minus_k);
+
+			len = 0;
+			decimal_exponent = -cached.k;
+			return grisu3_digit_gen(buf, len, decimal_exponent, w_minus, w, w_plus);
+		}
+
+		// shortest_exact  from_chars_exact ʹõ޷Ŵλǰ
+		struct bignum
+		{
+			// from_chars_exact гֵ768 λЧֵ double  2^3700 
+			enum _EBIGNUM { CAPACITY = 128 };
+
+			uint32_t w[CAPACITY];
+			int n;//ʹõߵַ
+
+			explicit bignum(uint64_t v) :n(0)
+			{
+				for (;v != 0;v >>= 32)
+					w[n++] = static_cast<uint32_t>(v);
+			}
+
+			void multiply(uint32_t m)
+			{
+				uint64_t carry = 0;
+				for (int i = 0;i != n;++i)
+				{
+					carry += static_cast<uint64_t>(w[i]) * m;
+					w[i] = static_cast<uint32_t>(carry);
+					carry >>= 32;
+				}
+				if (carry != 0)
+				{
+					assert(n < CAPACITY);
+					w[n++] = static_cast<uint32_t>(carry);
+				}
+			}
+
+			void multiply_pow10(int e)
+			{
+				static const uint32_t pows[] = { 1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000 };
+				for (;e >= 9;e -= 9)
+					multiply(1000000000);
+				multiply(pows[e]);
+			}
+
+			void shift_left(int k)
+			{
+				if (n == 0)
+					return;
+				const int words = k / 32, bits = k % 32;
+				if (bits != 0)
+				{
+					uint32_t carry = 0;
+					for (int i = 0;i != n;++i)
+					{
+						const uint32_t x = w[i];
+						w[i] = (x << bits) | carry;
+						carry = x >> (32 - bits);
+					}
+					if (carry != 0)
+					{
+						assert(n < CAPACITY);
+						w[n++] = carry;
+					}
+				}
+				if (words != 0)
+				{
+					assert(n + words <= CAPACITY);
+					memmove(w + words, w, n * sizeof(uint32_t));
+					memset(w, 0, words * sizeof(uint32_t));
+					n += words;
+				}
+			}
+
+			void add(const bignum &x)
+			{
+				const int m = n > x.n ? n : x.n;
+				uint64_t carry = 0;
+				for (int i = 0;i != m;++i)
+				{
+					carry += static_cast<uint64_t>(i < n ? w[i] : 0) + (i < x.n ? x.w[i] : 0);
+					w[i] = static_cast<uint32_t>(carry);
+					carry >>= 32;
+				}
+				n = m;
+				if (carry != 0)
+				{
+					assert(n < CAPACITY);
+					w[n++] = static_cast<uint32_t>(carry);
+				}
+			}
+
+			void add_small(uint32_t v)
+			{
+				uint64_t carry = v;
+				for (int i = 0;carry != 0 && i != n;++i)
+				{
+					carry += w[i];
+					w[i] = static_cast<uint32_t>(carry);
+					carry >>= 32;
+				}
+				if (carry != 0)
+				{
+					assert(n < CAPACITY);
+					w[n++] = static_cast<uint32_t>(carry);
+				}
+			}
+
+			// Ҫ *this >= x
+			void subtract(const bignum &x)
+			{
+				uint64_t borrow = 0;
+				for (int i = 0;i != n;++i)
+				{
+					const uint64_t y = (i < x.n ? x.w[i] : 0) + borrow;
+					borrow = w[i] < y;
+					w[i] = static_cast<uint32_t>(w[i] - y);
+				}
+				while (n > 0 && w[n - 1] == 0)
+					--n;
+			}
+		};
+
+		int compare(const bignum &x, const bignum &y)
+		{
+			if (x.n != y.n)
+				return x.n < y.n ? -1 : 1;
+			for (int i = x.n;i-- != 0;)
+				if (x.w[i] != y.w[i])
+					return x.w[i] < y.w[i] ? -1 : 1;
+			return 0;
+		}
+
+		// Ƚ x + y  z
+		int compare_sum(const bignum &x, const bignum &y, const bignum &z)
+		{
+			bignum t = x;
+			t.add(y);
+			return compare(t, z);
+		}
+
+		/*
+		* Burger & Dybvig ľȷ㷨"Printing Floating-Point Numbers Quickly and Accurately"
+		* value = r / sΪ [(r - m-) / s, (r + m+) / s]ЧλΪżʱ߽磨ʱż룩
+		* λֱ֣ʣµĲڣһλȡӽһ
+		*/
+		template<typename F>
+		void shortest_exact(char *buf, int &len, int &decimal_exponent, F value)
+		{
+			typedef typename std::conditional<sizeof(F) == 8, uint64_t, uint32_t>::type bits_type;
+			const int precision = std::numeric_limits<F>::digits;
+			const int bias = std::numeric_limits<F>::max_exponent - 1 + (precision - 1);
+			const uint64_t hidden_bit = uint64_t(1) << (precision - 1);
+
+			bits_type bits;
+			memcpy(&bits, &value, sizeof(bits));
+			const uint64_t E = bits >> (precision - 1);
+			const uint64_t M = bits & (hidden_bit - 1);
+			const uint64_t f = E == 0 ? M : M + hidden_bit;
+			const int e = E == 0 ? 1 - bias : static_cast<int>(E) - bias;
+			const bool even = (f & 1) == 0;
+			const bool lower_closer = M == 0 && E > 1;
+
+			// value = 4f * 2^(e-2)±߽ľΪ 2 * 2^(e-2)  2 1* 2^(e-2)
+			bignum r(4 * f), s(1), m_plus(2), m_minus(lower_closer ? 1 : 2);
+			if (e >= 2)
+			{
+				r.shift_left(e - 2);
+				m_plus.shift_left(e - 2);
+				m_minus.shift_left(e - 2);
+			}
+			else
+				s.shift_left(2 - e);
+
+			// Ƶ k ƫ (r + m+) / s <= 1߽ʱ < 1
+			int k = static_cast<int>(std::ceil(std::log10(static_cast<double>(value)) - 1e-10));
+			if (k >= 0)
+				s.multiply_pow10(k);
+			else
+			{
+				r.multiply_pow10(-k);
+				m_plus.multiply_pow10(-k);
+				m_minus.multiply_pow10(-k);
+			}
+			for (int c = compare_sum(r, m_plus, s);even ? c >= 0 : c > 0;c = compare_sum(r, m_plus, s))
+			{
+				s.multiply(10);
+				++k;
+			}
+
+			len = 0;
+			for (;;)
+			{
+				r.multiply(10);
+				m_plus.multiply(10);
+				m_minus.multiply(10);
+				int d = 0;
+				while (compare(r, s) >= 0)
+				{
+					r.subtract(s);
+					++d;
+				}
+				const int c_low = compare(r, m_minus);
+				const int c_high = compare_sum(r, m_plus, s);
+				const bool low_ok = even ? c_low <= 0 : c_low < 0;
+				const bool high_ok = even ? c_high >= 0 : c_high > 0;
+				if (low_ok && high_ok)
+				{
+					// d  d+1 ڣȡӽһһʱȡż
+					const int c = compare_sum(r, r, s);
+					if (c > 0 || (c == 0 && (d & 1) != 0))
+						++d;
+				}
+				else if (high_ok)
+					++d;
+				buf[len++] = static_cast<char>('0' + d);
+				if (low_ok || high_ok)
+					break;
+			}
+			decimal_exponent = k - len;
+		}
+
+		//  digits * 10^k Űʮƻѧдĩβ
+		char *format_digits(char *out, const char *digits, int len, int k)
+		{
+			const int n = len + k;//Сλ
+			if (k >= 0 && n <= 21)
+			{
+				memcpy(out, digits, len);
+				memset(out + len, '0', k);
+				return out + n;
+			}
+			if (0 < n && n <= 21)
+			{
+				memcpy(out, digits, n);
+				out[n] = '.';
+				memcpy(out + n + 1, digits + n, len - n);
+				return out + len + 1;
+			}
+			if (-6 < n && n <= 0)
+			{
+				out[0] = '0';
+				out[1] = '.';
+				memset(out + 2, '0', -n);
+				memcpy(out + 2 - n, digits, len);
+				return out + 2 - n + len;
+			}
+			*out++ = digits[0];
+			if (len > 1)
+			{
+				*out++ = '.';
+				memcpy(out, digits + 1, len - 1);
+				out += len - 1;
+			}
+			*out++ = 'e';
+			int e = n - 1;
+			if (e < 0)
+			{
+				*out++ = '-';
+				e = -e;
+			}
+			else
+				*out++ = '+';
+			unsigned ndigits = charconv_detail::count_digits(static_cast<unsigned>(e));
+			charconv_detail::write_digits(out + ndigits, static_cast<unsigned>(e));
+			return out + ndigits;
+		}
+
+		template<typename F>
+		to_chars_result to_chars_float(char *first, char *last, F value)
+		{
+			char buf[charconv_detail::MAX_CHARS];
+			char *p = buf;
+			if (std::signbit(value))
+			{
+				*p++ = '-';
+				value = -value;
+			}
+			if (std::isnan(value))
+			{
+				memcpy(p, "nan", 3);
+				p += 3;
+			}
+			else if (std::isinf(value))
+			{
+				memcpy(p, "inf", 3);
+				p += 3;
+			}
+			else if (value == 0)
+				*p++ = '0';
+			else
+			{
+				char digits[20];
+				int len, k;
+				if (!grisu3(digits, len, k, value))
+					shortest_exact(digits, len, k, value);
+				p = format_digits(p, digits, len, k);
+			}
+
+			const size_t n = static_cast<size_t>(p - buf);
+			if (static_cast<size_t>(last - first) < n)
+				return{ last, std::errc::value_too_large };
+			memcpy(first, buf, n);
+			return{ first + n, std::errc() };
+		}
+
+		// ִСдرȽ [p, last) ǰ׺ǷΪ lowerСд
+		inline bool match_prefix(const char *p, const char *last, const char *lower)
+		{
+			size_t n = strlen(lower);
+			if (static_cast<size_t>(last - p) < n)
+				return false;
+			for (size_t i = 0;i != n;++i)
+				if ((p[i] | 0x20) != lower[i])
+					return false;
+			return true;
+		}
+
+		// ܹȷʾΪ double  10 
+		static const double exact_pow10[] = { 1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10,
+			1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22 };
+
+		/*
+		*  w * 10^e10w 㣩 cached_powers е 10  64 λ˷
+		* ˻ 8 λw ʱ 40 
+		* ȥĵλһʱķȷģ򷵻 false
+		* ΪǹʱҲ false
+		*/
+		template<typename F>
+		bool diyfp_from_decimal(uint64_t w, int e10, bool truncated, F &value)
+		{
+			if (e10 < CACHED_POWERS_MIN_DEC_EXP)
+				return false;
+			const int index = (e10 - CACHED_POWERS_MIN_DEC_EXP) / CACHED_POWERS_DEC_STEP;
+			if (index >= static_cast<int>(sizeof(cached_powers) / sizeof(cached_powers[0])))
+				return false;
+			const cached_power &cached = cached_powers[index];
+
+			diyfp x = normalize(diyfp(w, 0));
+			x = normalize(mul(x, diyfp(cached.f, cached.e)));
+			const int rest = e10 - cached.k;//0 ~ 710^rest Ծȷʾ
+			if (rest != 0)
+				x = normalize(mul(x, normalize(diyfp(static_cast<uint64_t>(exact_pow10[rest]), 0))));
+
+			const int precision = std::numeric_limits<F>::digits;
+			const int drop = 64 - precision;
+			const uint64_t err = truncated ? 40 : 8;
+			const uint64_t low = x.f & ((uint64_t(1) << drop) - 1);
+			const uint64_t half = uint64_t(1) << (drop - 1);
+			if (low + err >= half && low <= half + err)
+				return false;
+			// λָΪ x.e + 63λʱټһ
+			if (x.e + 63 < std::numeric_limits<F>::min_exponent - 1 || x.e + 64 > std::numeric_limits<F>::max_exponent - 1)
+				return false;
+			uint64_t m = x.f >> drop;
+			if (low > half)
+				++m;
+			value = static_cast<F>(std::ldexp(static_cast<double>(m), x.e + drop));
+			return true;
+		}
+
+		// Ƚ d * 10^e10  g * 2^h
+		int compare_decimal(const bignum &d, int e10, uint64_t g, int h)
+		{
+			bignum lhs = d, rhs(g);
+			if (e10 >= 0)
+				lhs.multiply_pow10(e10);
+			else
+				rhs.multiply_pow10(-e10);
+			if (h >= 0)
+				rhs.shift_left(h);
+			else
+				lhs.shift_left(-h);
+			return compare(lhs, rhs);
+		}
+
+		/*
+		* ȷ·[first, last) ѾȷϺϷʮţ
+		* ȫЧֶ døõֵе㾫ȷȽϣ
+		*  ulp ȷĽ
+		* double ֵе 767 λЧֻ֣ǰ 768 λ
+		* ֮зʱһλ 1κеĴСϵ
+		*/
+		template<typename F>
+		from_chars_result from_chars_exact(const char *first, const char *last, bool neg, F &value)
+		{
+			enum { MAX_DIGITS = 768 };
+			bignum d(0);
+			uint64_t lead = 0;//ǰ 19 λЧ֣ڹƳֵ
+			int ndigits = 0;
+			int e10 = 0;
+			bool truncated = false;
+			bool fraction = false;
+			uint32_t chunk = 0;
+			int chunk_len = 0;
+			const char *p = first;
+			for (;p != last;++p)
+			{
+				if (*p == '.')
+				{
+					fraction = true;
+					continue;
+				}
+				const unsigned dgt = static_cast<unsigned char>(*p) - '0';
+				if (dgt > 9)
+					break;
+				if (ndigits == 0 && dgt == 0)
+				{
+					if (fraction)
+						--e10;
+					continue;
+				}
+				if (ndigits < MAX_DIGITS)
+				{
+					if (ndigits < 19)
+						lead = lead * 10 + dgt;
+					chunk = chunk * 10 + dgt;
+					if (++chunk_len == 9)
+					{
+						d.multiply(1000000000);
+						d.add_small(chunk);
+						chunk = 0;
+						chunk_len = 0;
+					}
+					++ndigits;
+					if (fraction)
+						--e10;
+				}
+				else
+				{
+					truncated |= dgt != 0;
+					if (!fraction)
+						++e10;
+				}
+			}
+			d.multiply_pow10(chunk_len);
+			d.add_small(chunk);
+			if (truncated)
+			{
+				d.multiply(10);
+				d.add_small(1);
+				--e10;
+			}
+			if (p != last && (*p | 0x20) == 'e')
+			{
+				++p;
+				bool exp_neg = false;
+				if (*p == '+' || *p == '-')
+					exp_neg = *p++ == '-';
+				int e = 0;
+				for (;p != last;++p)
+				{
+					if (e < 100000)
+						e = e * 10 + (*p - '0');
+				}
+				e10 += exp_neg ? -e : e;
+			}
+
+			// value λ [10^(dexp-1), 10^dexp)ʱټ
+			const int dexp = ndigits + e10 + (truncated ? 1 : 0);
+			if (dexp > std::numeric_limits<F>::max_exponent10 + 1
+				|| dexp <= std::numeric_limits<F>::min_exponent10 - std::numeric_limits<F>::max_digits10)
+				return{ last, std::errc::result_out_of_range };
+
+			// ֵǰ 19 λЧֳ 10 ݣֻм ulp
+			int e = dexp - (ndigits < 19 ? ndigits : 19);
+			double guess = static_cast<double>(lead);
+			for (;e > 22;e -= 22)
+				guess *= 1e22;
+			for (;e < -22;e += 22)
+				guess /= 1e22;
+			guess = e < 0 ? guess / exact_pow10[-e] : guess * exact_pow10[e];
+			F x = static_cast<F>(guess);
+			if (x == 0)
+				x = std::numeric_limits<F>::denorm_min();
+			else if (std::isinf(x))
+				x = std::numeric_limits<F>::max();
+
+			typedef typename std::conditional<sizeof(F) == 8, uint64_t, uint32_t>::type bits_type;
+			const int precision = std::numeric_limits<F>::digits;
+			const int bias = std::numeric_limits<F>::max_exponent - 1 + (precision - 1);
+			const uint64_t hidden_bit = uint64_t(1) << (precision - 1);
+			for (;;)
+			{
+				bits_type bits;
+				memcpy(&bits, &x, sizeof(bits));
+				const uint64_t E = bits >> (precision - 1);
+				const uint64_t M = bits & (hidden_bit - 1);
+				const uint64_t f = E == 0 ? M : M + hidden_bit;
+				const int be = E == 0 ? 1 - bias : static_cast<int>(E) - bias;
+				// еʱ뵽ЧλΪżһ
+				int c = compare_decimal(d, e10, 2 * f + 1, be - 1);
+				if (c > 0 || (c == 0 && (f & 1) != 0))
+				{
+					if (x == std::numeric_limits<F>::max())
+						return{ last, std::errc::result_out_of_range };
+					x = std::nextafter(x, std::numeric_limits<F>::infinity());
+					continue;
+				}
+				c = M == 0 && E > 1 ? compare_decimal(d, e10, 4 * f - 1, be - 2) : compare_decimal(d, e10, 2 * f - 1, be - 1);
+				if (c < 0 || (c == 0 && (f & 1) != 0))
+				{
+					x = std::nextafter(x, F(0));
+					if (x == 0)
+						return{ last, std::errc::result_out_of_range };
+					continue;
+				}
+				break;
+			}
+			value = neg ? -x : x;
+			return{ last, std::errc() };
+		}
+
+		template<typename F>
+		from_chars_result from_chars_float(const char *first, const char *last, F &value)
+		{
+			// ܹȷʾԼ 10 
+			const uint64_t max_exact_mantissa = uint64_t(1) << std::numeric_limits<F>::digits;
+			const int max_exact_pow10 = sizeof(F) == 8 ? 22 : 10;
+
+			const char *p = first;
+			bool neg = false;
+			if (p != last && *p == '-')
+			{
+				neg = true;
+				++p;
+			}
+			const char *digits = p;
+
+			if (p != last && ((*p | 0x20) == 'i' || (*p | 0x20) == 'n'))
+			{
+				if (match_prefix(p, last, "inf"))
+				{
+					p += match_prefix(p, last, "infinity") ? 8 : 3;
+					value = neg ? -std::numeric_limits<F>::infinity() : std::numeric_limits<F>::infinity();
+					return{ p, std::errc() };
+				}
+				if (match_prefix(p, last, "nan"))
+				{
+					p += 3;
+					// ѡ (n-char-sequence)
+					if (p != last && *p == '(')
+					{
+						const char *q = p + 1;
+						while (q != last && (isalnum(static_cast<unsigned char>(*q)) || *q == '_'))
+							++q;
+						if (q != last && *q == ')')
+							p = q + 1;
+					}
+					value = neg ? -std::numeric_limits<F>::quiet_NaN() : std::numeric_limits<F>::quiet_NaN();
+					return{ p, std::errc() };
+				}
+				return{ first, std::errc::invalid_argument };
+			}
+
+			uint64_t mantissa = 0;
+			int ndigits = 0;//Ѿ mantissa Чָ
+			int exp10 = 0;
+			bool truncated = false;//Ƿбķ
+			bool any = false;
+			for (;p != last;++p)
+			{
+				unsigned d = static_cast<unsigned char>(*p) - '0';
+				if (d > 9)
+					break;
+				any = true;
+				if (mantissa == 0 && d == 0)
+					continue;
+				if (ndigits < 19)
+				{
+					mantissa = mantissa * 10 + d;
+					++ndigits;
+				}
+				else
+				{
+					++exp10;
+					truncated |= d != 0;
+				}
+			}
+			if (p != last && *p == '.')
+			{
+				const char *q = p + 1;
+				for (;q != last;++q)
+				{
+					unsigned d = static_cast<unsigned char>(*q) - '0';
+					if (d > 9)
+						break;
+					any = true;
+					if (mantissa == 0 && d == 0)
+						--exp10;
+					else if (ndigits < 19)
+					{
+						mantissa = mantissa * 10 + d;
+						++ndigits;
+						--exp10;
+					}
+					else
+						truncated |= d != 0;
+				}
+				if (any)
+					p = q;
+			}
+			if (!any)
+				return{ first, std::errc::invalid_argument };
+
+			if (p != last && (*p | 0x20) == 'e')
+			{
+				const char *q = p + 1;
+				bool exp_neg = false;
+				if (q != last && (*q == '+' || *q == '-'))
+				{
+					exp_neg = *q == '-';
+					++q;
+				}
+				if (q != last && static_cast<unsigned>(static_cast<unsigned char>(*q) - '0') <= 9)
+				{
+					int e = 0;
+					for (;q != last;++q)
+					{
+						unsigned d = static_cast<unsigned char>(*q) - '0';
+						if (d > 9)
+							break;
+						if (e < 100000)
+							e = e * 10 + static_cast<int>(d);
+					}
+					exp10 += exp_neg ? -e : e;
+					p = q;
+				}
+			}
+
+			if (mantissa == 0)
+			{
+				value = neg ? -F(0) : F(0);
+				return{ p, std::errc() };
+			}
+			if (!truncated && mantissa <= max_exact_mantissa && -max_exact_pow10 <= exp10 && exp10 <= max_exact_pow10)
+			{
+				// ܾȷʾһγ˳Ľȷ
+				F r = static_cast<F>(mantissa);
+				const F scale = static_cast<F>(exact_pow10[exp10 < 0 ? -exp10 : exp10]);
+				r = exp10 < 0 ? r / scale : r * scale;
+				value = neg ? -r : r;
+				return{ p, std::errc() };
+			}
+			F r;
+			if (diyfp_from_decimal(mantissa, exp10, truncated, r))
+			{
+				value = neg ? -r : r;
+				return{ p, std::errc() };
+			}
+			return from_chars_exact(digits, p, neg, value);
+		}
+	}
+
+	to_chars_result to_chars(char *first, char *last, double value)
+	{
+		return to_chars_float(first, last, value);
+	}
+
+	to_chars_result to_chars(char *first, char *last, float value)
+	{
+		return to_chars_float(first, last, value);
+	}
+
+	from_chars_result from_chars(const char *first, const char *last, double &value)
+	{
+		return from_chars_float(first, last, value);
+	}
+
+	from_chars_result from_chars(const char *first, const char *last, float &value)
+	{
+		return from_chars_float(first, last, value);
+	}
+}
@@ -0,0 +1,185 @@
+#ifndef _CHARCONV_H
+#define _CHARCONV_H
+
+#include "mini_string.h"
+#include "mini_string_view.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <system_error>
+#include <type_traits>
+
+namespace miniSTL
+{
+	/*
+	* ֵַת
+	* ӿ C++17  std::to_chars / std::from_chars һ£ֻʮƣ
+	*  localeڴ棬ʧʱͨ ec ش
+	* λһܹȷԭ̱ʾжʱȡӽģ
+	*  Grisu3޷жôľȷ㷨
+	* ʽ JavaScript  Number.prototype.toString ͬ 0.11e+21-1.5e-7
+	* Ķȷ룺һ 64 λ˷ȷôȷȽ
+	* append_number() ֱӰѽ׷ӵе string ĩβ
+	*/
+	struct to_chars_result
+	{
+		char *ptr;
+		std::errc ec;
+	};
+
+	struct from_chars_result
+	{
+		const char *ptr;
+		std::errc ec;
+	};
+
+	namespace charconv_detail
+	{
+		enum _ECHARCONV { MAX_CHARS = 32 };//򸡵󳤶
+
+		static const char digit_pairs[201] =
+			"00010203040506070809"
+			"10111213141516171819"
+			"20212223242526272829"
+			"30313233343536373839"
+			"40414243444546474849"
+			"50515253545556575859"
+			"60616263646566676869"
+			"70717273747576777879"
+			"80818283848586878889"
+			"90919293949596979899";
+
+		template<typename U>
+		inline unsigned count_digits(U v)
+		{
+			unsigned n = 1;
+			for (;;)
+			{
+				if (v < 10) return n;
+				if (v < 100) return n + 1;
+				if (v < 1000) return n + 2;
+				if (v < 10000) return n + 3;
+				v /= 10000;
+				n += 4;
+			}
+		}
+
+		//  end ǰд v ʮƱʾ֤߱ռ㹻
+		template<typename U>
+		inline void write_digits(char *end, U v)
+		{
+			while (v >= 100)
+			{
+				const char *d = digit_pairs + (v % 100) * 2;
+				v /= 100;
+				*--end = d[1];
+				*--end = d[0];
+			}
+			if (v >= 10)
+			{
+				const char *d = digit_pairs + v * 2;
+				*--end = d[1];
+				*--end = d[0];
+			}
+			else
+				*--end = static_cast<char>('0' + v);
+		}
+	}
+
+	template<typename T>
+	to_chars_result to_chars(char *first, char *last, T value)
+	{
+		static_assert(std::is_integral<T>::value && !std::is_same<T, bool>::value, "to_chars requires an integer type");
+		typedef typename std::make_unsigned<T>::type U;
+		typedef typename std::conditional<(sizeof(U) < sizeof(unsigned)), unsigned, U>::type W;
+		W u = static_cast<U>(value);
+		if (std::is_signed<T>::value && value < T(0))
+		{
+			if (first == last)
+				return{ last, std::errc::value_too_large };
+			*first++ = '-';
+			u = static_cast<U>(U(0) - static_cast<U>(value));
+		}
+		unsigned n = charconv_detail::count_digits(u);
+		if (static_cast<size_t>(last - first) < n)
+			return{ last, std::errc::value_too_large };
+		charconv_detail::write_digits(first + n, u);
+		return{ first + n, std::errc() };
+	}
+
+	to_chars_result to_chars(char *first, char *last, double value);
+	to_chars_result to_chars(char *first, char *last, float value);
+
+	/*
+	*  [first, last) ͷʮţհҲ
+	* ûʱ invalid_argumentʱ result_out_of_range value 
+	*/
+	template<typename T>
+	from_chars_result from_chars(const char *first, const char *last, T &value)
+	{
+		static_assert(std::is_integral<T>::value && !std::is_same<T, bool>::value, "from_chars requires an integer type");
+		typedef typename std::make_unsigned<T>::type U;
+		const char *p = first;
+		bool neg = false;
+		if (std::is_signed<T>::value && p != last && *p == '-')
+		{
+			neg = true;
+			++p;
+		}
+		const U limit = neg ? static_cast<U>(static_cast<U>(std::numeric_limits<T>::max()) + 1)
+			: static_cast<U>(std::numeric_limits<T>::max());
+		const U limit_div = limit / 10, limit_mod = limit % 10;
+		const char *digits = p;
+		U r = 0;
+		bool overflow = false;
+		for (;p != last;++p)
+		{
+			unsigned d = static_cast<unsigned char>(*p) - '0';
+			if (d > 9)
+				break;
+			if (r > limit_div || (r == limit_div && d > limit_mod))
+				overflow = true;
+			else
+				r = static_cast<U>(r * 10 + d);
+		}
+		if (p == digits)
+			return{ first, std::errc::invalid_argument };
+		if (overflow)
+			return{ p, std::errc::result_out_of_range };
+		value = neg ? static_cast<T>(U(0) - r) : static_cast<T>(r);
+		return{ p, std::errc() };
+	}
+
+	/*
+	*  [-][.][(e|E)[+|-]] Լ infinfinitynanִСд
+	* Чֲ 19 λָСʱֱһγ˳õȷĽ
+	*  strtod/strtofǰС㻻ɵǰ locale д
+	*/
+	from_chars_result from_chars(const char *first, const char *last, double &value);
+	from_chars_result from_chars(const char *first, const char *last, float &value);
+
+	template<typename T>
+	inline from_chars_result from_chars(string_view sv, T &value)
+	{
+		return from_chars(sv.begin(), sv.end(), value);
+	}
+
+	template<typename T>
+	inline string &append_number(string &str, T value)
+	{
+		char buf[charconv_detail::MAX_CHARS];
+		to_chars_result r = to_chars(buf, buf + sizeof(buf), value);
+		return str.append(buf, static_cast<size_t>(r.ptr - buf));
+	}
+
+	template<typename T>
+	inline string to_string(T value)
+	{
+		string str;
+		append_number(str, value);
+		return str;
+	}
+}
+
+#endif
@@ -42,12 +42,12 @@ namespace miniSTL
 		}
 
 		//  destroy() ڶ汾˺跨ҳԪصֵͣ
-		//  __type_traits<> ȡʵʽ
+		//  __type_traits<> ȡʵʽƽʱʲôҲ
 		template <typename ForwardIterator>
 		inline void destroy(ForwardIterator first, ForwardIterator last)
 		{
-			typedef typename _type_traits<typename iterator_traits<ForwardIterator>::value_type>::is_POD_type is_POD_type;
-			_destroy(first, last, is_POD_type());
+			typedef typename _type_traits<typename iterator_traits<ForwardIterator>::value_type>::has_trivial_destructor trivial_destructor;
+			_destroy(first, last, trivial_destructor());
 		}
 	}
 	
@@ -0,0 +1,146 @@
+#ifndef _EYTZINGER_H
+#define _EYTZINGER_H
+
+#include "mini_allocator.h"
+#include "mini_functional.h"
+#include "mini_simd.h"
+
+#include <cstddef>
+#include <new>
+
+namespace miniSTL
+{
+	/*
+	* eytzinger_array а Eytzinger ˳򣨼ѵĲ򣩴ţ± k Ϊ 2k  2k+1
+	* ·ϵԪдǰУǰ㼯
+	*  4 ֮ 16 ѡڵǰһԤȡ
+	* ޷֧ģÿְ k Ϊ 2k  2k+1
+	* ʺϹһΡҺܶεֻұҽԪԭе±
+	*/
+	template <typename T,typename Compare = miniSTL::less<T>>
+	class eytzinger_array final
+	{
+	public:
+		typedef T			value_type;
+		typedef size_t		size_type;
+
+	private:
+		T *tree; // tree[1..n]tree[0] ʹ
+		size_type *ranks; // ranks[k] Ϊ tree[k] е±꣬ranks[0] Ϊ n
+		size_type n;
+		mutable Compare comp;
+
+	public:
+		eytzinger_array() :tree(nullptr), ranks(nullptr), n(0) {}
+
+		// [first,last) Ѱ comp ź
+		template <typename RandomIterator>
+		eytzinger_array(RandomIterator first, RandomIterator last, const Compare &c = Compare())
+			:n(last - first), comp(c)
+		{
+			tree = allocator<T>::allocate(n + 1);
+			ranks = allocator<size_type>::allocate(n + 1);
+			ranks[0] = n;
+			build(first, 0, 1);
+		}
+
+		eytzinger_array(eytzinger_array &&other) :tree(other.tree), ranks(other.ranks), n(other.n), comp(other.comp)
+		{
+			other.tree = nullptr;
+			other.ranks = nullptr;
+			other.n = 0;
+		}
+
+		eytzinger_array &operator=(eytzinger_array &&other)
+		{
+			if (this != &other)
+			{
+				release();
+				tree = other.tree;
+				ranks = other.ranks;
+				n = other.n;
+				comp = other.comp;
+				other.tree = nullptr;
+				other.ranks = nullptr;
+				other.n = 0;
+			}
+			return *this;
+		}
+
+		eytzinger_array(const eytzinger_array&) = delete;
+		eytzinger_array &operator=(const eytzinger_array&) = delete;
+
+		~eytzinger_array() { release(); }
+
+		size_type size() const { return n; }
+		bool empty() const { return n == 0; }
+
+		// һС value Ԫص±꣬ʱ size()
+		size_type lower_bound(const T &value) const { return search<false>(value); }
+
+		// һ value Ԫص±꣬ʱ size()
+		size_type upper_bound(const T &value) const { return search<true>(value); }
+
+		//  value ȵԪص±꣬ʱ size()
+		size_type find(const T &value) const
+		{
+			size_type k = search_node<false>(value);
+			return (k != 0 && !comp(value, tree[k])) ? ranks[k] : n;
+		}
+
+		bool contains(const T &value) const { return find(value) != n; }
+
+	private:
+		// УһԪص±
+		template <typename RandomIterator>
+		size_type build(RandomIterator first, size_type i, size_type k)
+		{
+			if (k <= n)
+			{
+				i = build(first, i, 2 * k);
+				new(tree + k) T(first[i]);
+				ranks[k] = i++;
+				i = build(first, i, 2 * k + 1);
+			}
+			return i;
+		}
+
+		// ؽڵĽڵ㣬0 ʾԪض
+		template <bool Upper>
+		size_type search_node(const T &value) const
+		{
+			size_type k = 1;
+			while (k <= n)
+			{
+				if ((k << 4) <= n)
+					simd::prefetch(tree + (k << 4));
+				bool right = Upper ? !comp(value, tree[k]) : comp(tree[k], value);
+				k = 2 * k + right;
+			}
+			// ȥĩβߵĲһߵһصǴ֮ǰĽڵ
+			return k >> (simd::count_trailing_zeros64(~static_cast<unsigned long long>(k)) + 1);
+		}
+
+		template <bool Upper>
+		size_type search(const T &value) const
+		{
+			return ranks[search_node<Upper>(value)];
+		}
+
+		void release()
+		{
+			if (tree)
+			{
+				for (size_type k = 1;k <= n;++k)
+					tree[k].~T();
+				allocator<T>::deallocate(tree, n + 1);
+				allocator<size_type>::deallocate(ranks, n + 1);
+			}
+			tree = nullptr;
+			ranks = nullptr;
+			n = 0;
+		}
+	};
+}
+
+#endif
@@ -0,0 +1,260 @@
+/*
+* ļʵ ʽ format/append_all
+*/
+#include "mini_format.h"
+
+namespace miniSTL
+{
+	namespace
+	{
+		struct format_spec
+		{
+			char fill;
+			char align;//'<' '>' '^'0 ʾ;
+			bool zero;
+			size_t width;
+			char type;
+
+			format_spec() :fill(' '), align(0), zero(false), width(0), type(0) {}
+		};
+
+		inline bool is_align(char c)
+		{
+			return c == '<' || c == '>' || c == '^';
+		}
+
+		inline bool is_digit(char c)
+		{
+			return static_cast<unsigned>(c - '0') <= 9;
+		}
+
+		//  spec ʱȵϽ
+		size_t estimate_size(const format_arg &a, const format_spec &spec)
+		{
+			size_t n;
+			switch (a.type)
+			{
+			case format_arg::STRING:
+				n = a.len;
+				break;
+			case format_arg::CHAR:
+				n = 1;
+				break;
+			case format_arg::BOOL:
+				n = 5;
+				break;
+			case format_arg::NONE:
+				n = 0;
+				break;
+			default:
+				n = charconv_detail::MAX_CHARS;
+				break;
+			}
+			return n < spec.width ? spec.width : n;
+		}
+
+		// ֤ out ٻ׷ n ַʱһ׷ӵͬһ string ʱܿԵ
+		void reserve_append(string &out, size_t n)
+		{
+			if (out.capacity() - out.size() >= n)
+				return;
+			const size_t required = out.size() + n;
+			const size_t doubled = out.capacity() * 2;
+			out.reserve(required < doubled ? doubled : required);
+		}
+
+		// ʮдĩβ
+		char *write_hex(char *out, unsigned long long v, bool upper)
+		{
+			const char *digits = upper ? "0123456789ABCDEF" : "0123456789abcdef";
+			unsigned n = 1;
+			for (unsigned long long t = v >> 4;t;t >>= 4)
+				++n;
+			char *end = out + n;
+			do
+			{
+				*--end = digits[v & 0xf];
+				v >>= 4;
+			} while (v);
+			return out + n;
+		}
+
+		//  body width ʱ spec 
+		void write_padded(string &out, const char *body, size_t n, const format_spec &spec, bool numeric)
+		{
+			if (spec.width <= n)
+			{
+				out.append(body, n);
+				return;
+			}
+			size_t pad = spec.width - n;
+			if (spec.zero && numeric && !spec.align)
+			{
+				// ڷź 0x ǰ׺֮
+				size_t prefix = 0;
+				if (prefix < n && body[prefix] == '-')
+					++prefix;
+				if (prefix + 1 < n && body[prefix] == '0' && body[prefix + 1] == 'x')
+					prefix += 2;
+				out.append(body, prefix);
+				out.append(pad, '0');
+				out.append(body + prefix, n - prefix);
+				return;
+			}
+			char align = spec.align ? spec.align : (numeric ? '>' : '<');
+			size_t left = align == '>' ? pad : align == '^' ? pad / 2 : 0;
+			out.append(left, spec.fill);
+			out.append(body, n);
+			out.append(pad - left, spec.fill);
+		}
+
+		void write_arg(string &out, const format_arg &a, const format_spec &spec)
+		{
+			char buf[charconv_detail::MAX_CHARS];
+			char *end = buf;
+			const bool hex = spec.type == 'x' || spec.type == 'X';
+			switch (a.type)
+			{
+			case format_arg::SIGNED:
+				if (hex)
+				{
+					unsigned long long v = static_cast<unsigned long long>(a.i);
+					if (a.i < 0)
+					{
+						*end++ = '-';
+						v = 0 - v;
+					}
+					end = write_hex(end, v, spec.type == 'X');
+				}
+				else
+					end = to_chars(buf, buf + sizeof(buf), a.i).ptr;
+				break;
+			case format_arg::UNSIGNED:
+				end = hex ? write_hex(buf, a.u, spec.type == 'X') : to_chars(buf, buf + sizeof(buf), a.u).ptr;
+				break;
+			case format_arg::DOUBLE:
+				end = to_chars(buf, buf + sizeof(buf), a.d).ptr;
+				break;
+			case format_arg::FLOAT:
+				end = to_chars(buf, buf + sizeof(buf), a.f).ptr;
+				break;
+			case format_arg::POINTER:
+				*end++ = '0';
+				*end++ = 'x';
+				end = write_hex(end, reinterpret_cast<uintptr_t>(a.p), spec.type == 'X');
+				break;
+			case format_arg::CHAR:
+				write_padded(out, &a.c, 1, spec, false);
+				return;
+			case format_arg::BOOL:
+				write_padded(out, a.b ? "true" : "false", a.b ? 4 : 5, spec, false);
+				return;
+			case format_arg::STRING:
+				write_padded(out, a.str, a.len, spec, false);
+				return;
+			default:
+				return;
+			}
+			write_padded(out, buf, static_cast<size_t>(end - buf), spec, true);
+		}
+
+		//  ':' ֮'}' ֮ǰĸʽ˵
+		const char *parse_spec(const char *p, const char *last, format_spec &spec)
+		{
+			if (last - p >= 2 && *p != '}' && is_align(p[1]))
+			{
+				spec.fill = p[0];
+				spec.align = p[1];
+				p += 2;
+			}
+			else if (p != last && is_align(*p))
+				spec.align = *p++;
+			if (p != last && *p == '0')
+			{
+				spec.zero = true;
+				++p;
+			}
+			for (;p != last && is_digit(*p);++p)
+				spec.width = spec.width * 10 + (*p - '0');
+			if (p != last && (*p == 'x' || *p == 'X'))
+				spec.type = *p++;
+			return p;
+		}
+	}
+
+	string &vformat_to(string &out, string_view fmt, const format_arg *args, size_t n)
+	{
+		const format_spec default_spec;
+		size_t estimate = fmt.size();
+		for (size_t i = 0;i != n;++i)
+			estimate += estimate_size(args[i], default_spec);
+		reserve_append(out, estimate);
+
+		const char *p = fmt.begin(), *last = fmt.end();
+		size_t next_index = 0;
+		while (p != last)
+		{
+			const char *q = p;
+			while (q != last && *q != '{' && *q != '}')
+				++q;
+			out.append(p, static_cast<size_t>(q - p));
+			if (q == last)
+				break;
+
+			if (*q == '}')
+			{
+				// "}}" һ '}' '}' ԭ
+				out.push_back('}');
+				p = q + 1 != last && q[1] == '}' ? q + 2 : q + 1;
+				continue;
+			}
+			if (q + 1 != last && q[1] == '{')
+			{
+				out.push_back('{');
+				p = q + 2;
+				continue;
+			}
+
+			const char *r = q + 1;
+			size_t index = 0;
+			if (r != last && is_digit(*r))
+			{
+				for (;r != last && is_digit(*r);++r)
+					index = index * 10 + (*r - '0');
+			}
+			else
+				index = next_index++;
+			format_spec spec;
+			if (r != last && *r == ':')
+				r = parse_spec(r + 1, last, spec);
+			if (r == last || *r != '}')
+			{
+				// ʽʣಿԭ
+				out.append(q, static_cast<size_t>(last - q));
+				break;
+			}
+			// ûжӦĲʱʲôҲ
+			if (index < n)
+			{
+				// ȴԤĳʱﲹ㣬֤һ
+				reserve_append(out, estimate_size(args[index], spec));
+				write_arg(out, args[index], spec);
+			}
+			p = r + 1;
+		}
+		return out;
+	}
+
+	string &vappend_all(string &out, const format_arg *args, size_t n)
+	{
+		const format_spec spec;
+		size_t estimate = 0;
+		for (size_t i = 0;i != n;++i)
+			estimate += estimate_size(args[i], spec);
+		reserve_append(out, estimate);
+
+		for (size_t i = 0;i != n;++i)
+			write_arg(out, args[i], spec);
+		return out;
+	}
+}
@@ -0,0 +1,104 @@
+#ifndef _FORMAT_H
+#define _FORMAT_H
+
+#include "mini_charconv.h"
+#include "mini_string.h"
+#include "mini_string_view.h"
+
+#include <cstddef>
+#include <cstring>
+
+namespace miniSTL
+{
+	/*
+	* ĸʽߣֱд string iostream
+	* ʽ fmt Ӽ
+	*   {}      ȡһ
+	*   {n}     ȡ n  0 ʼ
+	*   {:spec} spec Ϊ [[fill]align][0][width][type]
+	*           align ȡ < > ^type ȡ x  Xʮ
+	*   {{ }}   ű
+	* ֵĬҶ롢Ĭ룬̱ʾ mini_charconv.h
+	* ʽʱӳ '{' ʼԭʣಿ֣òڵĲʱôκ
+	* дǰȸݸʽͲԤռ䣬ռ䲻ʱһ
+	*  format_to / append_all ͬһ string ʱ̯ O(1)
+	*/
+	class format_arg
+	{
+	public:
+		enum arg_type { NONE, SIGNED, UNSIGNED, DOUBLE, FLOAT, CHAR, BOOL, STRING, POINTER };
+
+		arg_type type;
+		union
+		{
+			long long i;
+			unsigned long long u;
+			double d;
+			float f;
+			char c;
+			bool b;
+			const void *p;
+		};
+		const char *str = nullptr;
+		size_t len = 0;
+
+	public:
+		format_arg() :type(NONE), i(0) {}
+		format_arg(signed char v) :type(SIGNED), i(v) {}
+		format_arg(short v) :type(SIGNED), i(v) {}
+		format_arg(int v) :type(SIGNED), i(v) {}
+		format_arg(long v) :type(SIGNED), i(v) {}
+		format_arg(long long v) :type(SIGNED), i(v) {}
+		format_arg(unsigned char v) :type(UNSIGNED), u(v) {}
+		format_arg(unsigned short v) :type(UNSIGNED), u(v) {}
+		format_arg(unsigned int v) :type(UNSIGNED), u(v) {}
+		format_arg(unsigned long v) :type(UNSIGNED), u(v) {}
+		format_arg(unsigned long long v) :type(UNSIGNED), u(v) {}
+		format_arg(double v) :type(DOUBLE), d(v) {}
+		format_arg(float v) :type(FLOAT), f(v) {}
+		format_arg(char v) :type(CHAR), c(v) {}
+		format_arg(bool v) :type(BOOL), b(v) {}
+		format_arg(const void *v) :type(POINTER), p(v) {}
+		format_arg(const char *s) :type(STRING), i(0), str(s), len(strlen(s)) {}
+		format_arg(string_view sv) :type(STRING), i(0), str(sv.data()), len(sv.size()) {}
+		format_arg(const string &s) :type(STRING), i(0), str(s.data()), len(s.size()) {}
+	};
+
+	// ģʵֲ֣args ָ n 
+	string &vformat_to(string &out, string_view fmt, const format_arg *args, size_t n);
+	string &vappend_all(string &out, const format_arg *args, size_t n);
+
+	template<typename... Args>
+	inline string &format_to(string &out, string_view fmt, const Args&... args)
+	{
+		// һλãûвʱֳΪ 0 
+		const format_arg arr[sizeof...(Args) + 1] = { format_arg(args)... };
+		return vformat_to(out, fmt, arr, sizeof...(Args));
+	}
+
+	template<typename... Args>
+	inline string format(string_view fmt, const Args&... args)
+	{
+		string out;
+		format_to(out, fmt, args...);
+		return out;
+	}
+
+	// в׷ӵ out ĩβ൱һ operator+= ֻһ
+	template<typename... Args>
+	inline string &append_all(string &out, const Args&... args)
+	{
+		const format_arg arr[sizeof...(Args) + 1] = { format_arg(args)... };
+		return vappend_all(out, arr, sizeof...(Args));
+	}
+
+	template<typename... Args>
+	inline string concat(const Args&... args)
+	{
+		string out;
+		append_all(out, args...);
+		return out;
+	}
+}
+
+#endif
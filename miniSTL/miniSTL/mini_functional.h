@@ -33,6 +33,35 @@ namespace miniSTL
 		}
 	};
 
+	/*
+	* ĺreducetransform_reduce  scan ϵ㷨Ĭ
+	*/
+	template <typename T>
+	struct plus
+	{
+		typedef T first_argument_type;
+		typedef T second_argument_type;
+		typedef T result_type;
+
+		result_type operator()(const first_argument_type &a, const second_argument_type &b) const
+		{
+			return a + b;
+		}
+	};
+
+	template <typename T>
+	struct multiplies
+	{
+		typedef T first_argument_type;
+		typedef T second_argument_type;
+		typedef T result_type;
+
+		result_type operator()(const first_argument_type &a, const second_argument_type &b) const
+		{
+			return a * b;
+		}
+	};
+
 	template <typename Arg,typename Result>
 	struct unary_function
 	{
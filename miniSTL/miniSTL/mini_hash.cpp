@@ -0,0 +1,142 @@
+/*
+* ļʵ hash_bytes() гĲ
+*/
+#include "mini_hash.h"
+#include "mini_simd.h"
+
+namespace miniSTL
+{
+	namespace hash_detail
+	{
+		namespace
+		{
+			// wyhash ѭÿδ 48 ֽڣڲ֧ SSE2 ƽ̨еȳȵ
+			uint64_t hash_medium(const unsigned char *p, size_t len, uint64_t seed)
+			{
+				size_t i = len;
+				if (i > 48)
+				{
+					uint64_t see1 = seed, see2 = seed;
+					do
+					{
+						seed = mix(read8(p) ^ P1, read8(p + 8) ^ seed);
+						see1 = mix(read8(p + 16) ^ P2, read8(p + 24) ^ see1);
+						see2 = mix(read8(p + 32) ^ P3, read8(p + 40) ^ see2);
+						p += 48;
+						i -= 48;
+					} while (i > 48);
+					seed ^= see1 ^ see2;
+				}
+				while (i > 16)
+				{
+					seed = mix(read8(p) ^ P1, read8(p + 8) ^ seed);
+					i -= 16;
+					p += 16;
+				}
+				uint64_t a = read8(p + i - 16) ^ P1;
+				uint64_t b = read8(p + i - 8) ^ seed;
+				mum(a, b);
+				return mix(a ^ P0 ^ len, b ^ P1);
+			}
+
+#ifdef MINI_HAS_SSE2
+			enum _ESTRIPE { STRIPE_LEN = 64, STRIPES_PER_BLOCK = 16, BLOCK_LEN = STRIPE_LEN * STRIPES_PER_BLOCK };
+			enum _ELONG { LONG_THRESHOLD = 512 }; // ˳Ȳʹ SIMD ·
+
+			//  n ʹ secret + 8 * n  64 ֽΪԿ xxh3 ͬ
+			alignas(16) const unsigned char secret[STRIPE_LEN + 8 * STRIPES_PER_BLOCK] =
+			{
+				0xb8, 0xfe, 0x6c, 0x39, 0x23, 0xa4, 0x4b, 0xbe, 0x7c, 0x01, 0x81, 0x2c, 0xf7, 0x21, 0xad, 0x1c,
+				0xde, 0xd4, 0x6d, 0xe9, 0x83, 0x90, 0x97, 0xdb, 0x72, 0x40, 0xa4, 0xa4, 0xb7, 0xb3, 0x67, 0x1f,
+				0xcb, 0x79, 0xe6, 0x4e, 0xcc, 0xc0, 0xe5, 0x78, 0x82, 0x5a, 0xd0, 0x7d, 0xcc, 0xff, 0x72, 0x21,
+				0xb8, 0x08, 0x46, 0x74, 0xf7, 0x43, 0x24, 0x8e, 0xe0, 0x35, 0x90, 0xe6, 0x81, 0x3a, 0x26, 0x4c,
+				0x3c, 0x28, 0x52, 0xbb, 0x91, 0xc3, 0x00, 0xcb, 0x88, 0xd0, 0x65, 0x8b, 0x1b, 0x53, 0x2e, 0xa3,
+				0x71, 0x64, 0x48, 0x97, 0xa2, 0x0d, 0xf9, 0x4e, 0x38, 0x19, 0xef, 0x46, 0xa9, 0xde, 0xac, 0xd8,
+				0xa8, 0xfa, 0x76, 0x3f, 0xe3, 0x9c, 0x34, 0x3f, 0xf9, 0xdc, 0xbb, 0xc7, 0xc7, 0x0b, 0x4f, 0x1d,
+				0x8a, 0x51, 0xe0, 0x4b, 0xcd, 0xb4, 0x59, 0x31, 0xc8, 0x9f, 0x7e, 0xc9, 0xd9, 0x78, 0x73, 0x64,
+				0xea, 0xc5, 0xac, 0x83, 0x34, 0xd3, 0xeb, 0xc3, 0xc5, 0x81, 0xa0, 0xff, 0xfa, 0x13, 0x63, 0xeb,
+				0x17, 0x0d, 0xdd, 0x51, 0xb7, 0xf0, 0xda, 0x49, 0xd3, 0x16, 0x55, 0x26, 0x29, 0xd4, 0x68, 0x9e,
+				0x2b, 0x16, 0xbe, 0x58, 0x7d, 0x47, 0xa1, 0xfc, 0x8f, 0xf8, 0xb8, 0xd1, 0x7a, 0xd0, 0x31, 0xce,
+				0x45, 0xcb, 0x3a, 0x8f, 0x95, 0x16, 0x04, 0x28, 0xaf, 0xd7, 0xfb, 0xca, 0xbb, 0x4b, 0x40, 0x7e,
+			};
+
+			/*
+			* һ 64 ֽڵ8 · 64 λۼֲ 4  SSE2 Ĵ
+			* acc += swap64(data) + lo32(data ^ key) * hi32(data ^ key)
+			*/
+			inline void accumulate_stripe(__m128i acc[4], const unsigned char *p, const unsigned char *key)
+			{
+				for (int i = 0;i != 4;++i)
+				{
+					__m128i data = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p) + i);
+					__m128i k = _mm_loadu_si128(reinterpret_cast<const __m128i*>(key) + i);
+					__m128i data_key = _mm_xor_si128(data, k);
+					__m128i data_key_hi = _mm_shuffle_epi32(data_key, _MM_SHUFFLE(0, 3, 0, 1));
+					__m128i product = _mm_mul_epu32(data_key, data_key_hi);
+					__m128i data_swap = _mm_shuffle_epi32(data, _MM_SHUFFLE(1, 0, 3, 2));
+					acc[i] = _mm_add_epi64(acc[i], _mm_add_epi64(product, data_swap));
+				}
+			}
+
+			// ÿһһۼֹλϢʧ
+			inline void scramble(__m128i acc[4], const unsigned char *key)
+			{
+				const __m128i prime = _mm_set1_epi32(static_cast<int>(0x9E3779B1U));
+				for (int i = 0;i != 4;++i)
+				{
+					__m128i a = acc[i];
+					a = _mm_xor_si128(a, _mm_srli_epi64(a, 47));
+					a = _mm_xor_si128(a, _mm_loadu_si128(reinterpret_cast<const __m128i*>(key) + i));
+					// 64 λ 32 λ 32 λ 32 λֱ˺ϲ
+					__m128i lo = _mm_mul_epu32(a, prime);
+					__m128i hi = _mm_mul_epu32(_mm_srli_epi64(a, 32), prime);
+					acc[i] = _mm_add_epi64(lo, _mm_slli_epi64(hi, 32));
+				}
+			}
+
+			uint64_t hash_simd(const unsigned char *p, size_t len, uint64_t seed)
+			{
+				__m128i acc[4];
+				acc[0] = _mm_set_epi64x(static_cast<long long>(P1), static_cast<long long>(P0));
+				acc[1] = _mm_set_epi64x(static_cast<long long>(P3), static_cast<long long>(P2));
+				acc[2] = _mm_set_epi64x(static_cast<long long>(P1 ^ seed), static_cast<long long>(P0 ^ seed));
+				acc[3] = _mm_set_epi64x(static_cast<long long>(P3 ^ seed), static_cast<long long>(P2 ^ seed));
+
+				const unsigned char *block = p;
+				size_t blocks = (len - 1) / BLOCK_LEN;
+				for (size_t n = 0;n != blocks;++n, block += BLOCK_LEN)
+				{
+					for (size_t s = 0;s != STRIPES_PER_BLOCK;++s)
+						accumulate_stripe(acc, block + s * STRIPE_LEN, secret + 8 * s);
+					scramble(acc, secret + sizeof(secret) - STRIPE_LEN);
+				}
+
+				// һĿ飺ĩβ 64 ֽΪһ
+				size_t stripes = (len - 1 - blocks * BLOCK_LEN) / STRIPE_LEN;
+				for (size_t s = 0;s != stripes;++s)
+					accumulate_stripe(acc, block + s * STRIPE_LEN, secret + 8 * s);
+				accumulate_stripe(acc, p + len - STRIPE_LEN, secret + 8 * 7 + 3);
+
+				alignas(16) uint64_t lanes[8];
+				for (int i = 0;i != 4;++i)
+					_mm_store_si128(reinterpret_cast<__m128i*>(lanes) + i, acc[i]);
+
+				uint64_t result = len * P0 ^ seed;
+				for (int i = 0;i != 4;++i)
+					result += mix(lanes[2 * i] ^ read8(secret + 11 + 16 * i), lanes[2 * i + 1] ^ read8(secret + 19 + 16 * i));
+				return mix(result ^ P2, result ^ P3 ^ len);
+			}
+#endif
+		}
+
+		uint64_t hash_long(const unsigned char *p, size_t len, uint64_t seed)
+		{
+#ifdef MINI_HAS_SSE2
+			if (len > LONG_THRESHOLD)
+				return hash_simd(p, len, seed);
+#endif
+			seed ^= mix(seed ^ P0, P1);
+			return hash_medium(p, len, seed);
+		}
+	}
+}
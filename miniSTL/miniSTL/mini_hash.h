@@ -0,0 +1,209 @@
+#ifndef _HASH_H
+#define _HASH_H
+
+#include "mini_string_view.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+namespace miniSTL
+{
+	/*
+	* ɢк
+	* hash_bytes() ֽɢֵ wyhash 
+	* ʹ SSE2 ·ۼӣ֧ SSE2 ʱ˻Ϊ wyhash ѭ
+	* hash<T> ǹϣĬʹõĺָó˷ϣ
+	*  std::hash ֱӷԭֵ
+	*/
+	namespace hash_detail
+	{
+		static const uint64_t P0 = 0xa0761d6478bd642fULL;
+		static const uint64_t P1 = 0xe7037ed1a0b428dbULL;
+		static const uint64_t P2 = 0x8ebc6af09c88c6e3ULL;
+		static const uint64_t P3 = 0x589965cc75374cc3ULL;
+
+		// 64 λ 64 λõ 128 λֱ aλ bλ
+		inline void mum(uint64_t &a, uint64_t &b)
+		{
+#if defined(__SIZEOF_INT128__)
+			__uint128_t r = static_cast<__uint128_t>(a) * b;
+			a = static_cast<uint64_t>(r);
+			b = static_cast<uint64_t>(r >> 64);
+#elif defined(_MSC_VER) && defined(_M_X64)
+			a = _umul128(a, b, &b);
+#else
+			uint64_t ha = a >> 32, hb = b >> 32, la = static_cast<uint32_t>(a), lb = static_cast<uint32_t>(b);
+			uint64_t rh = ha * hb, rm0 = ha * lb, rm1 = hb * la, rl = la * lb;
+			uint64_t t = rl + (rm0 << 32), c = t < rl;
+			uint64_t lo = t + (rm1 << 32);
+			c += lo < t;
+			uint64_t hi = rh + (rm0 >> 32) + (rm1 >> 32) + c;
+			a = lo;
+			b = hi;
+#endif
+		}
+
+		inline uint64_t mix(uint64_t a, uint64_t b)
+		{
+			mum(a, b);
+			return a ^ b;
+		}
+
+		inline uint64_t read8(const unsigned char *p)
+		{
+			uint64_t v;
+			memcpy(&v, p, 8);
+			return v;
+		}
+
+		inline uint64_t read4(const unsigned char *p)
+		{
+			uint32_t v;
+			memcpy(&v, p, 4);
+			return v;
+		}
+
+		// 1  3 ֽڵ
+		inline uint64_t read3(const unsigned char *p, size_t k)
+		{
+			return (static_cast<uint64_t>(p[0]) << 16) | (static_cast<uint64_t>(p[k >> 1]) << 8) | p[k - 1];
+		}
+
+		// ȴ 16 룬ʵ mini_hash.cpp 
+		uint64_t hash_long(const unsigned char *p, size_t len, uint64_t seed);
+
+		// ϺõλҲڸλڰ 2 ݻȡģ
+		inline uint64_t mix_integer(uint64_t x)
+		{
+			x ^= x >> 32;
+			x *= 0xd6e8feb86659fd93ULL;
+			x ^= x >> 32;
+			x *= 0xd6e8feb86659fd93ULL;
+			x ^= x >> 32;
+			return x;
+		}
+	}
+
+	inline size_t hash_bytes(const void *data, size_t len, uint64_t seed = 0)
+	{
+		using namespace hash_detail;
+		const unsigned char *p = static_cast<const unsigned char*>(data);
+		if (len > 16)
+			return static_cast<size_t>(hash_long(p, len, seed));
+
+		// 16 ֽڵ루ļڴ
+		seed ^= mix(seed ^ P0, P1);
+		uint64_t a, b;
+		if (len >= 4)
+		{
+			a = (read4(p) << 32) | read4(p + ((len >> 3) << 2));
+			b = (read4(p + len - 4) << 32) | read4(p + len - 4 - ((len >> 3) << 2));
+		}
+		else if (len > 0)
+		{
+			a = read3(p, len);
+			b = 0;
+		}
+		else
+			a = b = 0;
+
+		a ^= P1;
+		b ^= seed;
+		mum(a, b);
+		return static_cast<size_t>(mix(a ^ P0 ^ len, b ^ P1));
+	}
+
+	template <typename T>
+	struct hash;
+
+	// 
+#define MINI_INTEGER_HASH(T) \
+	template <> \
+	struct hash<T> \
+	{ \
+		typedef T argument_type; \
+		typedef size_t result_type; \
+		size_t operator()(T x) const \
+		{ \
+			return static_cast<size_t>(hash_detail::mix_integer(static_cast<uint64_t>(x))); \
+		} \
+	};
+
+	MINI_INTEGER_HASH(bool)
+	MINI_INTEGER_HASH(char)
+	MINI_INTEGER_HASH(signed char)
+	MINI_INTEGER_HASH(unsigned char)
+	MINI_INTEGER_HASH(wchar_t)
+	MINI_INTEGER_HASH(char16_t)
+	MINI_INTEGER_HASH(char32_t)
+	MINI_INTEGER_HASH(short)
+	MINI_INTEGER_HASH(unsigned short)
+	MINI_INTEGER_HASH(int)
+	MINI_INTEGER_HASH(unsigned int)
+	MINI_INTEGER_HASH(long)
+	MINI_INTEGER_HASH(unsigned long)
+	MINI_INTEGER_HASH(long long)
+	MINI_INTEGER_HASH(unsigned long long)
+
+#undef MINI_INTEGER_HASH
+
+	template <typename T>
+	struct hash<T*>
+	{
+		typedef T* argument_type;
+		typedef size_t result_type;
+		size_t operator()(T *ptr) const
+		{
+			return static_cast<size_t>(hash_detail::mix_integer(reinterpret_cast<uintptr_t>(ptr)));
+		}
+	};
+
+	// λɢУ+0.0  -0.0 ȣͳһΪ 0
+	template <>
+	struct hash<float>
+	{
+		typedef float argument_type;
+		typedef size_t result_type;
+		size_t operator()(float x) const
+		{
+			if (x == 0.0f)
+				return hash<uint32_t>()(0);
+			uint32_t bits;
+			memcpy(&bits, &x, sizeof(bits));
+			return hash<uint32_t>()(bits);
+		}
+	};
+
+	template <>
+	struct hash<double>
+	{
+		typedef double argument_type;
+		typedef size_t result_type;
+		size_t operator()(double x) const
+		{
+			if (x == 0.0)
+				return hash<uint64_t>()(0);
+			uint64_t bits;
+			memcpy(&bits, &x, sizeof(bits));
+			return hash<uint64_t>()(bits);
+		}
+	};
+
+	template <typename CharT, typename Traits>
+	struct hash<basic_string_view<CharT, Traits>>
+	{
+		typedef basic_string_view<CharT, Traits> argument_type;
+		typedef size_t result_type;
+		size_t operator()(basic_string_view<CharT, Traits> sv) const
+		{
+			return hash_bytes(sv.data(), sv.size() * sizeof(CharT));
+		}
+	};
+}
+
+#endif
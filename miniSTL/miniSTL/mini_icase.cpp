@@ -0,0 +1,122 @@
+/*
+* ļʵ  ASCII СдıȽϡɢ
+*/
+#include "mini_icase.h"
+#include "mini_hash.h"
+#include "mini_simd.h"
+
+namespace miniSTL
+{
+	namespace
+	{
+		// ۵һֽͬڵ±꣬ȫͬʱ n
+		size_t mismatch_icase(const char *a, const char *b, size_t n)
+		{
+			size_t i = 0;
+#ifdef MINI_HAS_SSE2
+			for (;n - i >= 16;i += 16)
+			{
+				__m128i x = simd::to_lower_ascii(_mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i)));
+				__m128i y = simd::to_lower_ascii(_mm_loadu_si128(reinterpret_cast<const __m128i*>(b + i)));
+				unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(x, y))) ^ 0xFFFF;
+				if (mask != 0)
+					return i + simd::count_trailing_zeros(mask);
+			}
+#endif
+			for (;i != n;++i)
+			{
+				if (fold_ascii(a[i]) != fold_ascii(b[i]))
+					return i;
+			}
+			return n;
+		}
+
+		//  n ֽ۵д out
+		void fold_copy(char *out, const char *s, size_t n)
+		{
+			size_t i = 0;
+#ifdef MINI_HAS_SSE2
+			for (;n - i >= 16;i += 16)
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(out + i),
+					simd::to_lower_ascii(_mm_loadu_si128(reinterpret_cast<const __m128i*>(s + i))));
+#endif
+			for (;i != n;++i)
+				out[i] = fold_ascii(s[i]);
+		}
+	}
+
+	int compare_icase(string_view lhs, string_view rhs)
+	{
+		const size_t n = lhs.size() < rhs.size() ? lhs.size() : rhs.size();
+		const size_t i = mismatch_icase(lhs.data(), rhs.data(), n);
+		if (i != n)
+			return static_cast<unsigned char>(fold_ascii(lhs[i])) < static_cast<unsigned char>(fold_ascii(rhs[i])) ? -1 : 1;
+		return lhs.size() < rhs.size() ? -1 : lhs.size() > rhs.size() ? 1 : 0;
+	}
+
+	bool equal_icase(string_view lhs, string_view rhs)
+	{
+		return lhs.size() == rhs.size() && mismatch_icase(lhs.data(), rhs.data(), lhs.size()) == lhs.size();
+	}
+
+	size_t find_icase(string_view haystack, string_view needle, size_t pos)
+	{
+		const size_t n = haystack.size(), m = needle.size();
+		if (pos > n || m > n - pos)
+			return string_view::npos;
+		if (m == 0)
+			return pos;
+
+		/*
+		* ͬʱȽϺѡλϵַβַ߶ƥʱֽں˶м䲿
+		* ܹ˵ѡλ
+		*/
+		const char *s = haystack.data(), *t = needle.data();
+		const char first = fold_ascii(t[0]), last = fold_ascii(t[m - 1]);
+		const size_t middle = m < 2 ? 0 : m - 2;
+		const size_t limit = n - m;//һѡλ
+		size_t i = pos;
+#ifdef MINI_HAS_SSE2
+		const __m128i vfirst = _mm_set1_epi8(first), vlast = _mm_set1_epi8(last);
+		for (;i + 15 <= limit;i += 16)
+		{
+			__m128i a = simd::to_lower_ascii(_mm_loadu_si128(reinterpret_cast<const __m128i*>(s + i)));
+			__m128i b = simd::to_lower_ascii(_mm_loadu_si128(reinterpret_cast<const __m128i*>(s + i + m - 1)));
+			unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(a, vfirst), _mm_cmpeq_epi8(b, vlast))));
+			while (mask != 0)
+			{
+				size_t k = i + simd::count_trailing_zeros(mask);
+				if (mismatch_icase(s + k + 1, t + 1, middle) == middle)
+					return k;
+				mask &= mask - 1;
+			}
+		}
+#endif
+		for (;i <= limit;++i)
+		{
+			if (fold_ascii(s[i]) == first && fold_ascii(s[i + m - 1]) == last
+				&& mismatch_icase(s + i + 1, t + 1, middle) == middle)
+				return i;
+		}
+		return string_view::npos;
+	}
+
+	size_t hash_icase(string_view s)
+	{
+		// ֿ۵ջϵĻɢУǰһĽΪһ
+		enum { CHUNK = 128 };
+		char buf[CHUNK];
+		const char *p = s.data();
+		size_t n = s.size();
+		uint64_t h = 0;
+		do
+		{
+			const size_t k = n < CHUNK ? n : static_cast<size_t>(CHUNK);
+			fold_copy(buf, p, k);
+			h = hash_bytes(buf, k, h);
+			p += k;
+			n -= k;
+		} while (n != 0);
+		return static_cast<size_t>(h);
+	}
+}
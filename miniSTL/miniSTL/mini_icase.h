@@ -0,0 +1,69 @@
+#ifndef _ICASE_H
+#define _ICASE_H
+
+#include "mini_string_view.h"
+
+#include <cstddef>
+
+namespace miniSTL
+{
+	/*
+	*  ASCII СдıȽϡɢ
+	* ֻ۵ 'A'~'Z'ֽڣ UTF-8 ַֽԭֵȽ
+	* ۵ SIMD ĴɣСдstring ʽתΪ string_view ֱʹ
+	*/
+	inline char fold_ascii(char c)
+	{
+		return static_cast<unsigned>(c - 'A') < 26u ? static_cast<char>(c | 0x20) : c;
+	}
+
+	// ۵޷ֵֽȽϣֵĺͬ strcmp
+	int compare_icase(string_view lhs, string_view rhs);
+	bool equal_icase(string_view lhs, string_view rhs);
+	//  pos ʼ needleҲʱ string_view::npos
+	size_t find_icase(string_view haystack, string_view needle, size_t pos = 0);
+	//  equal_icase һµɢֵֻڴСдϲͬĴɢֵͬ
+	size_t hash_icase(string_view s);
+
+	/*
+	*  map/set  Compare unordered_set  Hash  KeyEqual ĺ
+	*   map<string, int, icase_less>
+	*   unordered_set<string, icase_hash, icase_equal_to>
+	*/
+	struct icase_less
+	{
+		typedef string_view first_argument_type;
+		typedef string_view second_argument_type;
+		typedef bool result_type;
+
+		bool operator()(string_view lhs, string_view rhs) const
+		{
+			return compare_icase(lhs, rhs) < 0;
+		}
+	};
+
+	struct icase_equal_to
+	{
+		typedef string_view first_argument_type;
+		typedef string_view second_argument_type;
+		typedef bool result_type;
+
+		bool operator()(string_view lhs, string_view rhs) const
+		{
+			return equal_icase(lhs, rhs);
+		}
+	};
+
+	struct icase_hash
+	{
+		typedef string_view argument_type;
+		typedef size_t result_type;
+
+		size_t operator()(string_view s) const
+		{
+			return hash_icase(s);
+		}
+	};
+}
+
+#endif
@@ -0,0 +1,107 @@
+/*
+* ļʵ жȡ line_reader
+*/
+#include "mini_line_reader.h"
+
+#include <cerrno>
+
+#ifdef _WIN32
+#include <io.h>
+#define MINI_READ(fd, buf, n) _read((fd), (buf), static_cast<unsigned int>(n))
+#else
+#include <unistd.h>
+#define MINI_READ(fd, buf, n) ::read((fd), (buf), (n))
+#endif
+
+namespace miniSTL
+{
+	line_reader::line_reader(int fd, char delim, size_t buffer_size)
+		:fd(fd), delim(delim), eof(false), error_code(0)
+	{
+		if (buffer_size == 0)
+			buffer_size = BUFSIZE;
+		buffer = data_allocator::allocate(buffer_size);
+		cur = last = buffer;
+		end_of_buffer = buffer + buffer_size;
+	}
+
+	line_reader::~line_reader()
+	{
+		data_allocator::deallocate(buffer, end_of_buffer - buffer);
+	}
+
+	bool line_reader::next(string_view &line)
+	{
+		// scan ֮ǰȷϲָظ
+		size_t scanned = 0;
+		for (;;)
+		{
+			auto pos = static_cast<char*>(memchr(cur + scanned, delim, last - cur - scanned));
+			if (pos)
+			{
+				line = string_view(cur, pos - cur);
+				cur = pos + 1;
+				return true;
+			}
+			scanned = last - cur;
+			if (eof)
+			{
+				// һûзָ
+				if (cur == last)
+					return false;
+				line = string_view(cur, last - cur);
+				cur = last;
+				return true;
+			}
+			fill();
+		}
+	}
+
+	bool line_reader::next(string &line)
+	{
+		string_view view;
+		if (!next(view))
+			return false;
+		line.clear();
+		line.append(view.data(), view.size());
+		return true;
+	}
+
+	void line_reader::fill()
+	{
+		size_t length_of_left = last - cur;
+		if (cur != buffer)
+		{
+			memmove(buffer, cur, length_of_left);
+			cur = buffer;
+			last = buffer + length_of_left;
+		}
+		if (last == end_of_buffer)
+		{
+			// һеĳȳ˻Ϊ
+			size_t old_size = end_of_buffer - buffer;
+			char *new_buffer = data_allocator::allocate(old_size * 2);
+			memcpy(new_buffer, buffer, length_of_left);
+			data_allocator::deallocate(buffer, old_size);
+			buffer = cur = new_buffer;
+			last = buffer + length_of_left;
+			end_of_buffer = buffer + old_size * 2;
+		}
+
+		for (;;)
+		{
+			auto n = MINI_READ(fd, last, end_of_buffer - last);
+			if (n > 0)
+			{
+				last += n;
+				return;
+			}
+			if (n < 0 && errno == EINTR)
+				continue;
+			if (n < 0)
+				error_code = errno;
+			eof = true;
+			return;
+		}
+	}
+}
@@ -0,0 +1,52 @@
+#ifndef _LINE_READER_H
+#define _LINE_READER_H
+
+#include "mini_allocator.h"
+#include "mini_string.h"
+#include "mini_string_view.h"
+
+namespace miniSTL
+{
+	/*
+	* ֱӻļİжȡ
+	* ÿ read() һݣڻ memchr ҷָ
+	*  iostreamҲΪÿһзڴ
+	* гʱ
+	* ȡرļ
+	*/
+	class line_reader final
+	{
+	private:
+		enum _EBUFSIZE { BUFSIZE = 64 * 1024 }; // ĬϻС
+
+		typedef miniSTL::allocator<char> data_allocator;
+
+		int fd;
+		char delim;
+		char *buffer;
+		char *cur; // δѵݵʼλ
+		char *last; // ѶݵĽλ
+		char *end_of_buffer;
+		bool eof;
+		int error_code; // read() ʧʱ errno0 ʾûд
+
+	public:
+		explicit line_reader(int fd, char delim = '\n', size_t buffer_size = BUFSIZE);
+		line_reader(const line_reader &) = delete;
+		line_reader &operator=(const line_reader &) = delete;
+		~line_reader();
+
+		// ȡһУָص view һε next() ֮ǰЧ
+		bool next(string_view &line);
+		// ȡһв line Уline ԭеĿռᱻ
+		bool next(string &line);
+
+		int error() const { return error_code; }
+
+	private:
+		// δѵƵͷݣʱ
+		void fill();
+	};
+}
+
+#endif
@@ -0,0 +1,129 @@
+/*
+* ļʵ ڴӳļ mapped_file
+*/
+#include "mini_mapped_file.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace miniSTL
+{
+#ifdef _WIN32
+	mapped_file::mapped_file()
+		:start(nullptr), length(0), file_handle(INVALID_HANDLE_VALUE), mapping_handle(nullptr), opened(false) {}
+#else
+	mapped_file::mapped_file()
+		:start(nullptr), length(0), fd(-1), opened(false) {}
+#endif
+
+	mapped_file::mapped_file(const char *path) :mapped_file()
+	{
+		open(path);
+	}
+
+	mapped_file::~mapped_file()
+	{
+		close();
+	}
+
+#ifdef _WIN32
+	bool mapped_file::open(const char *path)
+	{
+		close();
+		file_handle = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, nullptr,
+			OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+		if (file_handle == INVALID_HANDLE_VALUE)
+			return false;
+
+		LARGE_INTEGER file_size;
+		if (!GetFileSizeEx(file_handle, &file_size))
+		{
+			close();
+			return false;
+		}
+		length = static_cast<size_t>(file_size.QuadPart);
+		opened = true;
+		// ļ޷ӳ䣬ʱ data() Ϊָ롢size() Ϊ 0
+		if (length == 0)
+			return true;
+
+		mapping_handle = CreateFileMappingA(file_handle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		if (mapping_handle == nullptr)
+		{
+			close();
+			return false;
+		}
+		start = static_cast<const char*>(MapViewOfFile(mapping_handle, FILE_MAP_READ, 0, 0, 0));
+		if (start == nullptr)
+		{
+			close();
+			return false;
+		}
+		return true;
+	}
+
+	void mapped_file::close()
+	{
+		if (start)
+			UnmapViewOfFile(start);
+		if (mapping_handle)
+			CloseHandle(mapping_handle);
+		if (file_handle != INVALID_HANDLE_VALUE)
+			CloseHandle(file_handle);
+		start = nullptr;
+		length = 0;
+		mapping_handle = nullptr;
+		file_handle = INVALID_HANDLE_VALUE;
+		opened = false;
+	}
+#else
+	bool mapped_file::open(const char *path)
+	{
+		close();
+		fd = ::open(path, O_RDONLY);
+		if (fd < 0)
+			return false;
+
+		struct stat st;
+		if (fstat(fd, &st) != 0)
+		{
+			close();
+			return false;
+		}
+		length = static_cast<size_t>(st.st_size);
+		opened = true;
+		// ļ޷ӳ䣬ʱ data() Ϊָ롢size() Ϊ 0
+		if (length == 0)
+			return true;
+
+		void *ptr = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+		if (ptr == MAP_FAILED)
+		{
+			close();
+			return false;
+		}
+		start = static_cast<const char*>(ptr);
+		// ļ˳ʾں˼ӴԤѶҳ
+		madvise(ptr, length, MADV_SEQUENTIAL);
+		return true;
+	}
+
+	void mapped_file::close()
+	{
+		if (start)
+			munmap(const_cast<char*>(start), length);
+		if (fd >= 0)
+			::close(fd);
+		start = nullptr;
+		length = 0;
+		fd = -1;
+		opened = false;
+	}
+#endif
+}
@@ -0,0 +1,127 @@
+#ifndef _MAPPED_FILE_H
+#define _MAPPED_FILE_H
+
+#include "mini_iterator.h"
+#include "mini_simd.h"
+#include "mini_string_view.h"
+
+namespace miniSTL
+{
+	/*
+	* ¼һڴаָθÿ¼ string_view
+	* ¼ָĩβķָĿռ¼
+	*/
+	class record_iterator : public iterator<forward_iterator_tag, string_view>
+	{
+	private:
+		const char *next_record; // һ¼ʼλ
+		const char *last;
+		string_view record; // ǰ¼
+		char delim;
+		bool at_end;
+
+	public:
+		record_iterator() :next_record(nullptr), last(nullptr), delim('\n'), at_end(true) {}
+		record_iterator(const char *first, const char *last, char delim)
+			:next_record(first), last(last), delim(delim), at_end(false)
+		{
+			advance();
+		}
+
+		const string_view &operator*() const { return record; }
+		const string_view *operator->() const { return &record; }
+
+		record_iterator &operator++()
+		{
+			advance();
+			return *this;
+		}
+
+		record_iterator operator++(int)
+		{
+			auto result = *this;
+			advance();
+			return result;
+		}
+
+		bool operator==(const record_iterator &other) const
+		{
+			if (at_end || other.at_end)
+				return at_end == other.at_end;
+			return record.data() == other.record.data();
+		}
+
+		bool operator!=(const record_iterator &other) const { return !(*this == other); }
+
+	private:
+		void advance()
+		{
+			if (next_record == last)
+			{
+				at_end = true;
+				return;
+			}
+			const char *pos = simd::find_byte(next_record, last, delim);
+			record = string_view(next_record, pos - next_record);
+			next_record = (pos == last) ? last : pos + 1;
+		}
+	};
+
+	//  range-for ʹõļ¼
+	class record_range
+	{
+	private:
+		const char *first;
+		const char *last;
+		char delim;
+
+	public:
+		record_range(const char *first, const char *last, char delim)
+			:first(first), last(last), delim(delim) {}
+
+		record_iterator begin() const { return record_iterator(first, last, delim); }
+		record_iterator end() const { return record_iterator(); }
+	};
+
+	/*
+	* ֻڴӳļ
+	* ӳļʾϵͳ˳ԤPOSIX ʹ madvise(MADV_SEQUENTIAL)
+	* Windows ʹ FILE_FLAG_SEQUENTIAL_SCAN
+	* ͨ lines()/records() 㿽رļ
+	* õ string_view ļرǰЧҪʱʽ string
+	*/
+	class mapped_file final
+	{
+	private:
+		const char *start;
+		size_t length;
+#ifdef _WIN32
+		void *file_handle;
+		void *mapping_handle;
+#else
+		int fd;
+#endif
+		bool opened;
+
+	public:
+		mapped_file();
+		explicit mapped_file(const char *path);
+		mapped_file(const mapped_file &) = delete;
+		mapped_file &operator=(const mapped_file &) = delete;
+		~mapped_file();
+
+		// 򿪲ӳļʧʱ false
+		bool open(const char *path);
+		void close();
+		bool is_open() const { return opened; }
+
+		const char *data() const { return start; }
+		size_t size() const { return length; }
+		string_view view() const { return string_view(start, length); }
+
+		record_range lines() const { return records('\n'); }
+		record_range records(char delim) const { return record_range(start, start + length, delim); }
+	};
+}
+
+#endif
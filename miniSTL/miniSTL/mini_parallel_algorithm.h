@@ -0,0 +1,992 @@
+#ifndef _PARALLEL_ALGORITHM_H
+#define _PARALLEL_ALGORITHM_H
+
+#include "mini_algorithm.h"
+#include "mini_allocator.h"
+#include "mini_functional.h"
+#include "mini_thread_pool.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <atomic>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace miniSTL
+{
+	/*
+	*  thread_pool::default_pool() еĲ㷨ԼִвԵ㷨
+	* ϶ֻ̻̳߳һ߳ʱ˻ΪӦĴ㷨
+	*/
+	namespace
+	{
+		enum
+		{
+			PARALLEL_SORT_THRESHOLD = 1 << 15, // ôԪʱֱӴ
+			SAMPLE_SORT_MIN_BUCKET = 1 << 12, // ÿͰԪظ
+			SAMPLE_SORT_BUCKETS_PER_THREAD = 8,
+			SAMPLE_SORT_MAX_BUCKETS = 1 << 12, // Ͱ uint16_t 
+			SAMPLE_SORT_OVERSAMPLE = 32
+		};
+
+		//  [first,last) еԪƶ쵽δʼ out 
+		template <typename T>
+		void parallel_move_construct(T *first, T *last, T *out, task_group &group, size_t pieces)
+		{
+			const size_t n = last - first;
+			for (size_t p = 0;p != pieces;++p)
+			{
+				size_t lo = n * p / pieces, hi = n * (p + 1) / pieces;
+				group.run([=]()
+				{
+					for (size_t i = lo;i != hi;++i)
+						new(out + i) T(std::move(first[i]));
+				});
+			}
+			group.wait();
+		}
+
+		//  buf еԪƻ first  buf еԪ
+		template <typename T>
+		void parallel_move_back(T *buf, T *first, size_t n, task_group &group, size_t pieces)
+		{
+			for (size_t p = 0;p != pieces;++p)
+			{
+				size_t lo = n * p / pieces, hi = n * (p + 1) / pieces;
+				group.run([=]()
+				{
+					for (size_t i = lo;i != hi;++i)
+					{
+						first[i] = std::move(buf[i]);
+						buf[i].~T();
+					}
+				});
+			}
+			group.wait();
+		}
+
+		// ȶذ鲢 outout еԪѹ
+		template <typename T, typename Compare>
+		T *merge_move(T *a, T *a_last, T *b, T *b_last, T *out, Compare comp)
+		{
+			while (a != a_last && b != b_last)
+			{
+				if (comp(*b, *a))
+					*out++ = std::move(*b++);
+				else
+					*out++ = std::move(*a++);
+			}
+			while (a != a_last)
+				*out++ = std::move(*a++);
+			while (b != b_last)
+				*out++ = std::move(*b++);
+			return out;
+		}
+
+		/*
+		* 鲢 a[0,m)  b[0,l) ʱǰ k Ԫжٸ a
+		* ȵԪ a ǰ merge_move һ
+		*/
+		template <typename T, typename Compare>
+		size_t merge_split(const T *a, size_t m, const T *b, size_t l, size_t k, Compare comp)
+		{
+			size_t lo = k > l ? k - l : 0, hi = k < m ? k : m;
+			while (lo < hi)
+			{
+				size_t mid = lo + (hi - lo) / 2;
+				if (!comp(b[k - mid - 1], a[mid]))
+					lo = mid + 1;
+				else
+					hi = mid;
+			}
+			return lo;
+		}
+
+		/*
+		* ѹ鲢 pieces ν group ִУȴ
+		* ύԴеԪأҪзֵύ
+		*/
+		template <typename T, typename Compare>
+		void parallel_merge(T *a, size_t m, T *b, size_t l, T *out, Compare comp,
+			task_group &group, size_t pieces)
+		{
+			const size_t n = m + l;
+			size_t *split = allocator<size_t>::allocate(pieces + 1);
+			split[0] = 0;
+			split[pieces] = m;
+			for (size_t p = 1;p < pieces;++p)
+				split[p] = merge_split(a, m, b, l, n * p / pieces, comp);
+			for (size_t p = 0;p != pieces;++p)
+			{
+				size_t k0 = n * p / pieces, k1 = n * (p + 1) / pieces;
+				size_t i0 = split[p], i1 = split[p + 1];
+				if (k1 == k0)
+					continue;
+				group.run([=]() mutable
+				{
+					merge_move(a + i0, a + i1, b + (k0 - i0), b + (k1 - i1), out + k0, comp);
+				});
+			}
+			allocator<size_t>::deallocate(split, pieces + 1);
+		}
+
+		//  [spl,spl+count) вҵһ value ķָԪص±
+		template <typename T, typename Compare>
+		inline size_t find_bucket(const T *spl, size_t count, const T &value, Compare &comp)
+		{
+			size_t lo = 0, hi = count;
+			while (lo < hi)
+			{
+				size_t mid = (lo + hi) / 2;
+				if (comp(value, spl[mid]))
+					hi = mid;
+				else
+					lo = mid + 1;
+			}
+			return lo;
+		}
+	}
+
+	/*
+	* parallel_sort
+	* sample sort
+	*   ȳȡѡ B-1 ָԪ
+	*   ̷ֿ߳ͳÿԪͰٲеذԪطɢռ
+	*   Ͱ sort() ƻԭ
+	* ָԪظʱĳָԪصԪصͰЩͰ
+	* Ҫ O(N) ĸռ䣬ԪҪɿ죨ڱָԪأ
+	*/
+	template <typename T, typename Compare>
+	void parallel_sort(T *first, T *last, Compare comp)
+	{
+		thread_pool &pool = thread_pool::default_pool();
+		const size_t n = last - first;
+		const size_t threads = pool.concurrency();
+		size_t buckets = threads * SAMPLE_SORT_BUCKETS_PER_THREAD;
+		if (buckets > SAMPLE_SORT_MAX_BUCKETS)
+			buckets = SAMPLE_SORT_MAX_BUCKETS;
+		if (buckets > n / SAMPLE_SORT_MIN_BUCKET)
+			buckets = n / SAMPLE_SORT_MIN_BUCKET;
+		if (n < PARALLEL_SORT_THRESHOLD || threads == 1 || buckets < 2)
+		{
+			miniSTL::sort(first, last, comp);
+			return;
+		}
+
+		// ѡָԪأÿȡһαλãԹغ
+		const size_t sample_n = buckets * SAMPLE_SORT_OVERSAMPLE;
+		T *sample = allocator<T>::allocate(sample_n);
+		uint64_t seed = 0x9E3779B97F4A7C15ull ^ n;
+		for (size_t i = 0;i != sample_n;++i)
+		{
+			seed = seed * 6364136223846793005ull + 1442695040888963407ull;
+			size_t lo = n * i / sample_n, hi = n * (i + 1) / sample_n;
+			new(sample + i) T(first[lo + (seed >> 33) % (hi - lo)]);
+		}
+		miniSTL::sort(sample, sample + sample_n, comp);
+		T *spl = allocator<T>::allocate(buckets - 1);
+		size_t spl_count = 0;
+		bool has_equal_buckets = false;
+		for (size_t i = 1;i != buckets;++i)
+		{
+			const T &s = sample[i * SAMPLE_SORT_OVERSAMPLE];
+			// ظķָԪ
+			if (spl_count != 0 && !comp(spl[spl_count - 1], s))
+			{
+				has_equal_buckets = true;
+				continue;
+			}
+			new(spl + spl_count++) T(s);
+		}
+		for (size_t i = 0;i != sample_n;++i)
+			sample[i].~T();
+		allocator<T>::deallocate(sample, sample_n);
+
+		// Ͱ 2j  (spl[j-1],spl[j]) еԪأͰ 2j-1 ŵ spl[j-1] Ԫ
+		const size_t bucket_count = 2 * spl_count + 1;
+		const size_t blocks = threads;
+		uint16_t *bucket_of = allocator<uint16_t>::allocate(n);
+		size_t *offsets = allocator<size_t>::allocate(blocks * bucket_count);
+		memset(offsets, 0, blocks * bucket_count * sizeof(size_t));
+		task_group group(pool);
+
+		for (size_t blk = 0;blk != blocks;++blk)
+		{
+			size_t lo = n * blk / blocks, hi = n * (blk + 1) / blocks;
+			group.run([=]() mutable
+			{
+				size_t *cnt = offsets + blk * bucket_count;
+				for (size_t i = lo;i != hi;++i)
+				{
+					size_t j = find_bucket(spl, spl_count, first[i], comp);
+					size_t b = 2 * j;
+					if (has_equal_buckets && j != 0 && !comp(spl[j - 1], first[i]))
+						b = 2 * j - 1;
+					bucket_of[i] = static_cast<uint16_t>(b);
+					++cnt[b];
+				}
+			});
+		}
+		group.wait();
+
+		// ÿÿͰедλ
+		size_t *bucket_start = allocator<size_t>::allocate(bucket_count + 1);
+		size_t sum = 0;
+		for (size_t b = 0;b != bucket_count;++b)
+		{
+			bucket_start[b] = sum;
+			for (size_t blk = 0;blk != blocks;++blk)
+			{
+				size_t c = offsets[blk * bucket_count + b];
+				offsets[blk * bucket_count + b] = sum;
+				sum += c;
+			}
+		}
+		bucket_start[bucket_count] = n;
+
+		T *buf = allocator<T>::allocate(n);
+		for (size_t blk = 0;blk != blocks;++blk)
+		{
+			size_t lo = n * blk / blocks, hi = n * (blk + 1) / blocks;
+			group.run([=]()
+			{
+				size_t *pos = offsets + blk * bucket_count;
+				for (size_t i = lo;i != hi;++i)
+					new(buf + pos[bucket_of[i]]++) T(std::move(first[i]));
+			});
+		}
+		group.wait();
+
+		for (size_t b = 0;b != bucket_count;++b)
+		{
+			size_t lo = bucket_start[b], hi = bucket_start[b + 1];
+			if (lo == hi)
+				continue;
+			bool need_sort = (b % 2 == 0) && hi - lo > 1;
+			group.run([=]() mutable
+			{
+				if (need_sort)
+					miniSTL::sort(buf + lo, buf + hi, comp);
+				for (size_t i = lo;i != hi;++i)
+				{
+					first[i] = std::move(buf[i]);
+					buf[i].~T();
+				}
+			});
+		}
+		group.wait();
+
+		allocator<T>::deallocate(buf, n);
+		allocator<size_t>::deallocate(bucket_start, bucket_count + 1);
+		allocator<size_t>::deallocate(offsets, blocks * bucket_count);
+		allocator<uint16_t>::deallocate(bucket_of, n);
+		for (size_t i = 0;i != spl_count;++i)
+			spl[i].~T();
+		allocator<T>::deallocate(spl, buckets - 1);
+	}
+
+	template <typename T>
+	void parallel_sort(T *first, T *last)
+	{
+		parallel_sort(first, last, less<T>());
+	}
+
+	/*
+	* parallel_stable_sort
+	* ̷ֱָ߳ stable_sort  timsort 鲢
+	* ÿι鲢λöֲзֵ㣬ɶβִ
+	* Ҫ O(N) ĸռ
+	*/
+	template <typename T, typename Compare>
+	void parallel_stable_sort(T *first, T *last, Compare comp)
+	{
+		thread_pool &pool = thread_pool::default_pool();
+		const size_t n = last - first;
+		const size_t threads = pool.concurrency();
+		if (n < PARALLEL_SORT_THRESHOLD || threads == 1)
+		{
+			miniSTL::stable_sort(first, last, comp);
+			return;
+		}
+
+		const size_t chunks = threads;
+		T *buf = allocator<T>::allocate(n);
+		task_group group(pool);
+		size_t *bounds = allocator<size_t>::allocate(chunks + 1);
+		for (size_t c = 0;c <= chunks;++c)
+			bounds[c] = n * c / chunks;
+		// ξ͵buf жӦδʼռΪöεĹ鲢ʱռ䣬̲߳ڴ
+		for (size_t c = 0;c != chunks;++c)
+		{
+			size_t lo = bounds[c], hi = bounds[c + 1];
+			group.run([=]() mutable
+			{
+				merge_buffer<T> scratch(buf + lo, hi - lo);
+				timsort(first + lo, first + hi, comp, scratch);
+			});
+		}
+		group.wait();
+
+		// ֮ buf Уfirst  buf Ϊ鲢Ŀ
+		parallel_move_construct(first, last, buf, group, chunks);
+		T *src = buf, *dst = first;
+		size_t runs = chunks;
+		while (runs > 1)
+		{
+			size_t next = 0;
+			for (size_t r = 0;r < runs;r += 2)
+			{
+				size_t lo = bounds[r];
+				if (r + 1 == runs)
+				{
+					// 䵥һԭȥ
+					size_t hi = bounds[r + 1];
+					group.run([=]()
+					{
+						for (size_t i = lo;i != hi;++i)
+							dst[i] = std::move(src[i]);
+					});
+				}
+				else
+				{
+					size_t mid = bounds[r + 1], hi = bounds[r + 2];
+					size_t pieces = (hi - lo) * threads / n + 1;
+					parallel_merge(src + lo, mid - lo, src + mid, hi - mid, dst + lo, comp, group, pieces);
+				}
+				bounds[next++] = lo;
+			}
+			bounds[next] = n;
+			runs = next;
+			group.wait();
+			T *tmp = src;
+			src = dst;
+			dst = tmp;
+		}
+
+		if (src == buf)
+		{
+			parallel_move_back(buf, first, n, group, chunks);
+		}
+		else
+		{
+			for (size_t i = 0;i != n;++i)
+				buf[i].~T();
+		}
+		allocator<size_t>::deallocate(bounds, chunks + 1);
+		allocator<T>::deallocate(buf, n);
+	}
+
+	template <typename T>
+	void parallel_stable_sort(T *first, T *last)
+	{
+		parallel_stable_sort(first, last, less<T>());
+	}
+
+	/*
+	* ִвԣΪ㷨ĵһѡִзʽ
+	*   seq       ڵ߳ϴִ
+	*   par        thread_pool::default_pool() Ϸֿ鲢ִ
+	*   par_unseq  par ͬڲǼѭ
+	* 䲻ʵֻ̫̻̳߳һ߳ʱpar Ҳ˻Ϊִ
+	* ִʱᱻƵ飬ڶ߳ͬʱã֮䲻Ӧ໥
+	*/
+	namespace execution
+	{
+		struct sequenced_policy {};
+		struct parallel_policy {};
+		struct parallel_unsequenced_policy {};
+
+		const sequenced_policy seq = sequenced_policy();
+		const parallel_policy par = parallel_policy();
+		const parallel_unsequenced_policy par_unseq = parallel_unsequenced_policy();
+	}
+
+	template <typename T>
+	struct is_execution_policy
+	{
+		static const bool value = false;
+	};
+
+	template <> struct is_execution_policy<execution::sequenced_policy> { static const bool value = true; };
+	template <> struct is_execution_policy<execution::parallel_policy> { static const bool value = true; };
+	template <> struct is_execution_policy<execution::parallel_unsequenced_policy> { static const bool value = true; };
+
+	// ExecutionPolicy ִвʱΪ R򲻲ؾ飬봮а汾
+	template <typename ExecutionPolicy,typename R>
+	struct _enable_if_execution_policy
+		:std::enable_if<is_execution_policy<typename std::decay<ExecutionPolicy>::type>::value, R>
+	{
+	};
+
+	/*
+	* ҪСеʵʱΪ _true_type
+	*/
+	template <typename ExecutionPolicy,typename Iterator1,typename Iterator2 = Iterator1>
+	struct _is_parallel_execution
+	{
+		typedef typename std::decay<ExecutionPolicy>::type policy;
+		static const bool value = !std::is_same<policy, execution::sequenced_policy>::value &&
+			std::is_same<typename iterator_traits<Iterator1>::iterator_category, random_access_iterator_tag>::value &&
+			std::is_same<typename iterator_traits<Iterator2>::iterator_category, random_access_iterator_tag>::value;
+		typedef typename FirstOrSecond<value, _true_type, _false_type>::result type;
+	};
+
+	namespace
+	{
+		enum
+		{
+			// ÿٴôֽڣԼΪ L2 ķ֮һڵڻУ
+			// ͬʱ֤ÿĹԶύĿ
+			PARALLEL_CHUNK_BYTES = 1 << 16,
+			// ÿ߳ƽֵĿһ̷̵ֵ߳߳Ĺ
+			PARALLEL_CHUNKS_PER_THREAD = 4,
+			// find_if ÿôԪؿһǷڸǰλҵ
+			PARALLEL_FIND_CHECK_INTERVAL = 1024
+		};
+
+		//  n  elem_bytes ֽڵԪطֳɶٿ飬 1 ʾӦִ
+		inline size_t parallel_chunk_count(size_t n, size_t elem_bytes)
+		{
+			const size_t threads = thread_pool::default_pool().concurrency();
+			if (threads == 1)
+				return 1;
+			size_t chunks = n / (PARALLEL_CHUNK_BYTES / (elem_bytes < PARALLEL_CHUNK_BYTES ? elem_bytes : PARALLEL_CHUNK_BYTES));
+			if (chunks > threads * PARALLEL_CHUNKS_PER_THREAD)
+				chunks = threads * PARALLEL_CHUNKS_PER_THREAD;
+			return chunks < 2 ? 1 : chunks;
+		}
+
+		/*
+		*  [0,n) ֳ chunks 飬Ե c  [lo,hi)  f(c, lo, hi)
+		* 齻̳߳أԼִе 0 飬Ȼȴȫ
+		* ÿ f һݿ
+		*/
+		template <typename Function>
+		void parallel_chunks(size_t n, size_t chunks, Function f)
+		{
+			task_group group(thread_pool::default_pool());
+			for (size_t c = 1;c < chunks;++c)
+			{
+				size_t lo = n * c / chunks, hi = n * (c + 1) / chunks;
+				group.run([=]() mutable { f(c, lo, hi); });
+			}
+			f(0, 0, n / chunks);
+			group.wait();
+		}
+
+		/*
+		* ÿ± i  map(i) op Լ init ϲ
+		* Ĳֽ˳ϲ
+		*/
+		template <typename T,typename BinaryOperation,typename Map>
+		T parallel_map_reduce(size_t n, size_t chunks, T init, BinaryOperation op, Map map)
+		{
+			T *partial = allocator<T>::allocate(chunks);
+			parallel_chunks(n, chunks, [=](size_t c, size_t lo, size_t hi) mutable
+			{
+				T acc = map(lo);
+				for (size_t i = lo + 1;i != hi;++i)
+					acc = op(acc, map(i));
+				new(partial + c) T(std::move(acc));
+			});
+			for (size_t c = 0;c != chunks;++c)
+			{
+				init = op(init, partial[c]);
+				partial[c].~T();
+			}
+			allocator<T>::deallocate(partial, chunks);
+			return init;
+		}
+
+		/*
+		* ɵĲǰ׺ͣ
+		*   ֱԪصۻ
+		*   еÿ֮ǰԪأ initۻ
+		*   Լʼۻд
+		* init Ϊָʾûгֵinclusive Ϊ false ʱ exclusive_scanʱгֵ
+		*/
+		template <typename RandomIterator1,typename RandomIterator2,typename T,typename BinaryOperation>
+		RandomIterator2 parallel_scan(RandomIterator1 first, size_t n, RandomIterator2 result,
+			BinaryOperation op, const T *init, bool inclusive, size_t chunks)
+		{
+			T *partial = allocator<T>::allocate(chunks);
+			// һۻò
+			parallel_chunks(n, chunks - 1, [=](size_t c, size_t, size_t) mutable
+			{
+				size_t lo = n * c / chunks, hi = n * (c + 1) / chunks;
+				T acc = first[lo];
+				for (size_t i = lo + 1;i != hi;++i)
+					acc = op(acc, first[i]);
+				new(partial + c) T(std::move(acc));
+			});
+
+			// prefix[c] Ϊ c ֮ǰۻûгֵʱ 0 û prefix
+			T *prefix = allocator<T>::allocate(chunks);
+			const bool has_init = init != nullptr;
+			if (has_init)
+				new(prefix) T(*init);
+			for (size_t c = 0;c + 1 != chunks;++c)
+			{
+				if (c == 0 && !has_init)
+					new(prefix + 1) T(partial[0]);
+				else
+					new(prefix + c + 1) T(op(prefix[c], partial[c]));
+				partial[c].~T();
+			}
+			allocator<T>::deallocate(partial, chunks);
+
+			parallel_chunks(n, chunks, [=](size_t c, size_t lo, size_t hi) mutable
+			{
+				if (inclusive)
+				{
+					T acc = (c == 0 && !has_init) ? T(first[lo]) : op(prefix[c], first[lo]);
+					result[lo] = acc;
+					for (size_t i = lo + 1;i != hi;++i)
+					{
+						acc = op(acc, first[i]);
+						result[i] = acc;
+					}
+				}
+				else
+				{
+					T acc = prefix[c];
+					for (size_t i = lo;i != hi;++i)
+					{
+						T next = op(acc, first[i]);
+						result[i] = acc;
+						acc = std::move(next);
+					}
+				}
+			});
+			for (size_t c = (has_init ? 0 : 1);c != chunks;++c)
+				prefix[c].~T();
+			allocator<T>::deallocate(prefix, chunks);
+			return result + n;
+		}
+
+		template <typename InputIterator,typename Function>
+		void _for_each_policy(InputIterator first, InputIterator last, Function f, _false_type)
+		{
+			miniSTL::for_each(first, last, f);
+		}
+
+		template <typename RandomIterator,typename Function>
+		void _for_each_policy(RandomIterator first, RandomIterator last, Function f, _true_type)
+		{
+			const size_t n = last - first;
+			const size_t chunks = parallel_chunk_count(n, sizeof(*first));
+			if (chunks == 1)
+			{
+				miniSTL::for_each(first, last, f);
+				return;
+			}
+			parallel_chunks(n, chunks, [=](size_t, size_t lo, size_t hi) mutable
+			{
+				for (size_t i = lo;i != hi;++i)
+					f(first[i]);
+			});
+		}
+
+		template <typename InputIterator,typename OutputIterator,typename UnaryOperation>
+		OutputIterator _transform_policy(InputIterator first, InputIterator last,
+			OutputIterator result, UnaryOperation op, _false_type)
+		{
+			return miniSTL::transform(first, last, result, op);
+		}
+
+		template <typename RandomIterator1,typename RandomIterator2,typename UnaryOperation>
+		RandomIterator2 _transform_policy(RandomIterator1 first, RandomIterator1 last,
+			RandomIterator2 result, UnaryOperation op, _true_type)
+		{
+			const size_t n = last - first;
+			const size_t chunks = parallel_chunk_count(n, sizeof(*first) + sizeof(*result));
+			if (chunks == 1)
+				return miniSTL::transform(first, last, result, op);
+			parallel_chunks(n, chunks, [=](size_t, size_t lo, size_t hi) mutable
+			{
+				for (size_t i = lo;i != hi;++i)
+					result[i] = op(first[i]);
+			});
+			return result + n;
+		}
+
+		template <typename InputIterator1,typename InputIterator2,typename OutputIterator,typename BinaryOperation>
+		OutputIterator _transform2_policy(InputIterator1 first1, InputIterator1 last1,
+			InputIterator2 first2, OutputIterator result, BinaryOperation op, _false_type)
+		{
+			return miniSTL::transform(first1, last1, first2, result, op);
+		}
+
+		template <typename RandomIterator1,typename RandomIterator2,typename RandomIterator3,typename BinaryOperation>
+		RandomIterator3 _transform2_policy(RandomIterator1 first1, RandomIterator1 last1,
+			RandomIterator2 first2, RandomIterator3 result, BinaryOperation op, _true_type)
+		{
+			const size_t n = last1 - first1;
+			const size_t chunks = parallel_chunk_count(n, sizeof(*first1) + sizeof(*first2) + sizeof(*result));
+			if (chunks == 1)
+				return miniSTL::transform(first1, last1, first2, result, op);
+			parallel_chunks(n, chunks, [=](size_t, size_t lo, size_t hi) mutable
+			{
+				for (size_t i = lo;i != hi;++i)
+					result[i] = op(first1[i], first2[i]);
+			});
+			return result + n;
+		}
+
+		template <typename InputIterator,typename T,typename BinaryReduceOperation,typename UnaryTransformOperation>
+		T _transform_reduce_policy(InputIterator first, InputIterator last, T init,
+			BinaryReduceOperation reduce_op, UnaryTransformOperation transform_op, _false_type)
+		{
+			return miniSTL::transform_reduce(first, last, init, reduce_op, transform_op);
+		}
+
+		template <typename RandomIterator,typename T,typename BinaryReduceOperation,typename UnaryTransformOperation>
+		T _transform_reduce_policy(RandomIterator first, RandomIterator last, T init,
+			BinaryReduceOperation reduce_op, UnaryTransformOperation transform_op, _true_type)
+		{
+			const size_t n = last - first;
+			const size_t chunks = parallel_chunk_count(n, sizeof(*first));
+			if (chunks == 1)
+				return miniSTL::transform_reduce(first, last, init, reduce_op, transform_op);
+			return parallel_map_reduce(n, chunks, init, reduce_op,
+				[=](size_t i) mutable -> T { return transform_op(first[i]); });
+		}
+
+		template <typename InputIterator1,typename InputIterator2,typename T,
+			typename BinaryReduceOperation,typename BinaryTransformOperation>
+		T _transform_reduce2_policy(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2, T init,
+			BinaryReduceOperation reduce_op, BinaryTransformOperation transform_op, _false_type)
+		{
+			return miniSTL::transform_reduce(first1, last1, first2, init, reduce_op, transform_op);
+		}
+
+		template <typename RandomIterator1,typename RandomIterator2,typename T,
+			typename BinaryReduceOperation,typename BinaryTransformOperation>
+		T _transform_reduce2_policy(RandomIterator1 first1, RandomIterator1 last1, RandomIterator2 first2, T init,
+			BinaryReduceOperation reduce_op, BinaryTransformOperation transform_op, _true_type)
+		{
+			const size_t n = last1 - first1;
+			const size_t chunks = parallel_chunk_count(n, sizeof(*first1) + sizeof(*first2));
+			if (chunks == 1)
+				return miniSTL::transform_reduce(first1, last1, first2, init, reduce_op, transform_op);
+			return parallel_map_reduce(n, chunks, init, reduce_op,
+				[=](size_t i) mutable -> T { return transform_op(first1[i], first2[i]); });
+		}
+
+		template <typename InputIterator,typename UnaryPredicate>
+		InputIterator _find_if_policy(InputIterator first, InputIterator last, UnaryPredicate pred, _false_type)
+		{
+			return miniSTL::find_if(first, last, pred);
+		}
+
+		// ǰңԭӱ¼ĿǰҵС±꣬λĿǰ
+		template <typename RandomIterator,typename UnaryPredicate>
+		RandomIterator _find_if_policy(RandomIterator first, RandomIterator last, UnaryPredicate pred, _true_type)
+		{
+			const size_t n = last - first;
+			const size_t chunks = parallel_chunk_count(n, sizeof(*first));
+			if (chunks == 1)
+				return miniSTL::find_if(first, last, pred);
+			std::atomic<size_t> found(n);
+			std::atomic<size_t> *found_ptr = &found;
+			parallel_chunks(n, chunks, [=](size_t, size_t lo, size_t hi) mutable
+			{
+				for (size_t i = lo;i != hi;++i)
+				{
+					if ((i - lo) % PARALLEL_FIND_CHECK_INTERVAL == 0 && found_ptr->load(std::memory_order_relaxed) < lo)
+						return;
+					if (pred(first[i]))
+					{
+						size_t cur = found_ptr->load(std::memory_order_relaxed);
+						while (i < cur && !found_ptr->compare_exchange_weak(cur, i, std::memory_order_relaxed))
+							;
+						return;
+					}
+				}
+			});
+			return first + found.load(std::memory_order_relaxed);
+		}
+
+		template <typename InputIterator,typename UnaryPredicate>
+		typename iterator_traits<InputIterator>::difference_type
+			_count_if_policy(InputIterator first, InputIterator last, UnaryPredicate pred, _false_type)
+		{
+			return miniSTL::count_if(first, last, pred);
+		}
+
+		template <typename RandomIterator,typename UnaryPredicate>
+		typename iterator_traits<RandomIterator>::difference_type
+			_count_if_policy(RandomIterator first, RandomIterator last, UnaryPredicate pred, _true_type)
+		{
+			typedef typename iterator_traits<RandomIterator>::difference_type difference_type;
+			const size_t n = last - first;
+			const size_t chunks = parallel_chunk_count(n, sizeof(*first));
+			if (chunks == 1)
+				return miniSTL::count_if(first, last, pred);
+			return parallel_map_reduce(n, chunks, difference_type(0), plus<difference_type>(),
+				[=](size_t i) mutable -> difference_type { return pred(first[i]) ? 1 : 0; });
+		}
+
+		template <typename ForwardIterator,typename T>
+		void _fill_policy(ForwardIterator first, ForwardIterator last, const T &value, _false_type)
+		{
+			miniSTL::fill(first, last, value);
+		}
+
+		template <typename RandomIterator,typename T>
+		void _fill_policy(RandomIterator first, RandomIterator last, const T &value, _true_type)
+		{
+			const size_t n = last - first;
+			const size_t chunks = parallel_chunk_count(n, sizeof(*first));
+			if (chunks == 1)
+			{
+				miniSTL::fill(first, last, value);
+				return;
+			}
+			const T *value_ptr = &value;
+			parallel_chunks(n, chunks, [=](size_t, size_t lo, size_t hi)
+			{
+				miniSTL::fill(first + lo, first + hi, *value_ptr);
+			});
+		}
+
+		template <typename InputIterator,typename OutputIterator>
+		OutputIterator _copy_policy(InputIterator first, InputIterator last, OutputIterator result, _false_type)
+		{
+			return miniSTL::copy(first, last, result);
+		}
+
+		template <typename RandomIterator1,typename RandomIterator2>
+		RandomIterator2 _copy_policy(RandomIterator1 first, RandomIterator1 last, RandomIterator2 result, _true_type)
+		{
+			const size_t n = last - first;
+			const size_t chunks = parallel_chunk_count(n, sizeof(*first));
+			if (chunks == 1)
+				return miniSTL::copy(first, last, result);
+			parallel_chunks(n, chunks, [=](size_t, size_t lo, size_t hi)
+			{
+				miniSTL::copy(first + lo, first + hi, result + lo);
+			});
+			return result + n;
+		}
+
+		template <typename InputIterator,typename OutputIterator,typename T,typename BinaryOperation>
+		OutputIterator _scan_policy(InputIterator first, InputIterator last, OutputIterator result,
+			BinaryOperation op, const T *init, bool inclusive, _false_type)
+		{
+			if (inclusive)
+				return init ? miniSTL::inclusive_scan(first, last, result, op, *init)
+					: miniSTL::inclusive_scan(first, last, result, op);
+			return miniSTL::exclusive_scan(first, last, result, *init, op);
+		}
+
+		template <typename RandomIterator1,typename RandomIterator2,typename T,typename BinaryOperation>
+		RandomIterator2 _scan_policy(RandomIterator1 first, RandomIterator1 last, RandomIterator2 result,
+			BinaryOperation op, const T *init, bool inclusive, _true_type)
+		{
+			const size_t n = last - first;
+			// ǰ׺Ҫ룬д
+			const size_t chunks = parallel_chunk_count(n, 2 * sizeof(*first) + sizeof(*result));
+			if (chunks == 1)
+				return _scan_policy(first, last, result, op, init, inclusive, _false_type());
+			return parallel_scan(first, n, result, op, init, inclusive, chunks);
+		}
+	}
+
+	/*
+	* ǴִвԵ㷨ӦĴа汾ͬ
+	* for_each غΪʹõǸԵĿ
+	*/
+	template <typename ExecutionPolicy,typename ForwardIterator,typename Function>
+	typename _enable_if_execution_policy<ExecutionPolicy, void>::type
+		for_each(ExecutionPolicy&&, ForwardIterator first, ForwardIterator last, Function f)
+	{
+		typedef typename _is_parallel_execution<ExecutionPolicy, ForwardIterator>::type is_parallel;
+		_for_each_policy(first, last, f, is_parallel());
+	}
+
+	template <typename ExecutionPolicy,typename ForwardIterator1,typename ForwardIterator2,typename UnaryOperation>
+	typename _enable_if_execution_policy<ExecutionPolicy, ForwardIterator2>::type
+		transform(ExecutionPolicy&&, ForwardIterator1 first, ForwardIterator1 last,
+			ForwardIterator2 result, UnaryOperation op)
+	{
+		typedef typename _is_parallel_execution<ExecutionPolicy, ForwardIterator1, ForwardIterator2>::type is_parallel;
+		return _transform_policy(first, last, result, op, is_parallel());
+	}
+
+	template <typename ExecutionPolicy,typename ForwardIterator1,typename ForwardIterator2,
+		typename ForwardIterator3,typename BinaryOperation>
+	typename _enable_if_execution_policy<ExecutionPolicy, ForwardIterator3>::type
+		transform(ExecutionPolicy&&, ForwardIterator1 first1, ForwardIterator1 last1,
+			ForwardIterator2 first2, ForwardIterator3 result, BinaryOperation op)
+	{
+		typedef typename FirstOrSecond<_is_parallel_execution<ExecutionPolicy, ForwardIterator1, ForwardIterator2>::value &&
+			_is_parallel_execution<ExecutionPolicy, ForwardIterator3>::value, _true_type, _false_type>::result is_parallel;
+		return _transform2_policy(first1, last1, first2, result, op, is_parallel());
+	}
+
+	template <typename ExecutionPolicy,typename ForwardIterator,typename T,
+		typename BinaryReduceOperation,typename UnaryTransformOperation>
+	typename _enable_if_execution_policy<ExecutionPolicy, T>::type
+		transform_reduce(ExecutionPolicy&&, ForwardIterator first, ForwardIterator last, T init,
+			BinaryReduceOperation reduce_op, UnaryTransformOperation transform_op)
+	{
+		typedef typename _is_parallel_execution<ExecutionPolicy, ForwardIterator>::type is_parallel;
+		return _transform_reduce_policy(first, last, init, reduce_op, transform_op, is_parallel());
+	}
+
+	template <typename ExecutionPolicy,typename ForwardIterator1,typename ForwardIterator2,typename T,
+		typename BinaryReduceOperation,typename BinaryTransformOperation>
+	typename _enable_if_execution_policy<ExecutionPolicy, T>::type
+		transform_reduce(ExecutionPolicy&&, ForwardIterator1 first1, ForwardIterator1 last1,
+			ForwardIterator2 first2, T init, BinaryReduceOperation reduce_op, BinaryTransformOperation transform_op)
+	{
+		typedef typename _is_parallel_execution<ExecutionPolicy, ForwardIterator1, ForwardIterator2>::type is_parallel;
+		return _transform_reduce2_policy(first1, last1, first2, init, reduce_op, transform_op, is_parallel());
+	}
+
+	template <typename ExecutionPolicy,typename ForwardIterator1,typename ForwardIterator2,typename T>
+	typename _enable_if_execution_policy<ExecutionPolicy, T>::type
+		transform_reduce(ExecutionPolicy &&policy, ForwardIterator1 first1, ForwardIterator1 last1,
+			ForwardIterator2 first2, T init)
+	{
+		return miniSTL::transform_reduce(std::forward<ExecutionPolicy>(policy), first1, last1, first2, init,
+			plus<T>(), multiplies<T>());
+	}
+
+	// ÿԪԭԼ
+	template <typename T>
+	struct _identity_transform
+	{
+		const T &operator()(const T &x) const { return x; }
+	};
+
+	template <typename ExecutionPolicy,typename ForwardIterator,typename T,typename BinaryOperation>
+	typename _enable_if_execution_policy<ExecutionPolicy, T>::type
+		reduce(ExecutionPolicy &&policy, ForwardIterator first, ForwardIterator last, T init, BinaryOperation op)
+	{
+		typedef typename iterator_traits<ForwardIterator>::value_type value_type;
+		return miniSTL::transform_reduce(std::forward<ExecutionPolicy>(policy), first, last, init, op,
+			_identity_transform<value_type>());
+	}
+
+	template <typename ExecutionPolicy,typename ForwardIterator,typename T>
+	typename _enable_if_execution_policy<ExecutionPolicy, T>::type
+		reduce(ExecutionPolicy &&policy, ForwardIterator first, ForwardIterator last, T init)
+	{
+		return miniSTL::reduce(std::forward<ExecutionPolicy>(policy), first, last, init, plus<T>());
+	}
+
+	template <typename ExecutionPolicy,typename ForwardIterator>
+	typename _enable_if_execution_policy<ExecutionPolicy, typename iterator_traits<ForwardIterator>::value_type>::type
+		reduce(ExecutionPolicy &&policy, ForwardIterator first, ForwardIterator last)
+	{
+		typedef typename iterator_traits<ForwardIterator>::value_type value_type;
+		return miniSTL::reduce(std::forward<ExecutionPolicy>(policy), first, last, value_type(), plus<value_type>());
+	}
+
+	template <typename ExecutionPolicy,typename ForwardIterator1,typename ForwardIterator2,
+		typename BinaryOperation,typename T>
+	typename _enable_if_execution_policy<ExecutionPolicy, ForwardIterator2>::type
+		inclusive_scan(ExecutionPolicy&&, ForwardIterator1 first, ForwardIterator1 last,
+			ForwardIterator2 result, BinaryOperation op, T init)
+	{
+		typedef typename _is_parallel_execution<ExecutionPolicy, ForwardIterator1, ForwardIterator2>::type is_parallel;
+		return _scan_policy(first, last, result, op, &init, true, is_parallel());
+	}
+
+	template <typename ExecutionPolicy,typename ForwardIterator1,typename ForwardIterator2,typename BinaryOperation>
+	typename _enable_if_execution_policy<ExecutionPolicy, ForwardIterator2>::type
+		inclusive_scan(ExecutionPolicy&&, ForwardIterator1 first, ForwardIterator1 last,
+			ForwardIterator2 result, BinaryOperation op)
+	{
+		typedef typename _is_parallel_execution<ExecutionPolicy, ForwardIterator1, ForwardIterator2>::type is_parallel;
+		typedef typename iterator_traits<ForwardIterator1>::value_type value_type;
+		return _scan_policy(first, last, result, op, static_cast<const value_type*>(nullptr), true, is_parallel());
+	}
+
+	template <typename ExecutionPolicy,typename ForwardIterator1,typename ForwardIterator2>
+	typename _enable_if_execution_policy<ExecutionPolicy, ForwardIterator2>::type
+		inclusive_scan(ExecutionPolicy &&policy, ForwardIterator1 first, ForwardIterator1 last, ForwardIterator2 result)
+	{
+		return miniSTL::inclusive_scan(std::forward<ExecutionPolicy>(policy), first, last, result,
+			plus<typename iterator_traits<ForwardIterator1>::value_type>());
+	}
+
+	template <typename ExecutionPolicy,typename ForwardIterator1,typename ForwardIterator2,
+		typename T,typename BinaryOperation>
+	typename _enable_if_execution_policy<ExecutionPolicy, ForwardIterator2>::type
+		exclusive_scan(ExecutionPolicy&&, ForwardIterator1 first, ForwardIterator1 last,
+			ForwardIterator2 result, T init, BinaryOperation op)
+	{
+		typedef typename _is_parallel_execution<ExecutionPolicy, ForwardIterator1, ForwardIterator2>::type is_parallel;
+		return _scan_policy(first, last, result, op, &init, false, is_parallel());
+	}
+
+	template <typename ExecutionPolicy,typename ForwardIterator1,typename ForwardIterator2,typename T>
+	typename _enable_if_execution_policy<ExecutionPolicy, ForwardIterator2>::type
+		exclusive_scan(ExecutionPolicy &&policy, ForwardIterator1 first, ForwardIterator1 last,
+			ForwardIterator2 result, T init)
+	{
+		return miniSTL::exclusive_scan(std::forward<ExecutionPolicy>(policy), first, last, result, init, plus<T>());
+	}
+
+	template <typename ExecutionPolicy,typename ForwardIterator,typename T>
+	typename _enable_if_execution_policy<ExecutionPolicy, void>::type
+		fill(ExecutionPolicy&&, ForwardIterator first, ForwardIterator last, const T &value)
+	{
+		typedef typename _is_parallel_execution<ExecutionPolicy, ForwardIterator>::type is_parallel;
+		_fill_policy(first, last, value, is_parallel());
+	}
+
+	template <typename ExecutionPolicy,typename ForwardIterator1,typename ForwardIterator2>
+	typename _enable_if_execution_policy<ExecutionPolicy, ForwardIterator2>::type
+		copy(ExecutionPolicy&&, ForwardIterator1 first, ForwardIterator1 last, ForwardIterator2 result)
+	{
+		typedef typename _is_parallel_execution<ExecutionPolicy, ForwardIterator1, ForwardIterator2>::type is_parallel;
+		return _copy_policy(first, last, result, is_parallel());
+	}
+
+	template <typename ExecutionPolicy,typename ForwardIterator,typename UnaryPredicate>
+	typename _enable_if_execution_policy<ExecutionPolicy, ForwardIterator>::type
+		find_if(ExecutionPolicy&&, ForwardIterator first, ForwardIterator last, UnaryPredicate pred)
+	{
+		typedef typename _is_parallel_execution<ExecutionPolicy, ForwardIterator>::type is_parallel;
+		return _find_if_policy(first, last, pred, is_parallel());
+	}
+
+	template <typename ExecutionPolicy,typename ForwardIterator,typename UnaryPredicate>
+	typename _enable_if_execution_policy<ExecutionPolicy, typename iterator_traits<ForwardIterator>::difference_type>::type
+		count_if(ExecutionPolicy&&, ForwardIterator first, ForwardIterator last, UnaryPredicate pred)
+	{
+		typedef typename _is_parallel_execution<ExecutionPolicy, ForwardIterator>::type is_parallel;
+		return _count_if_policy(first, last, pred, is_parallel());
+	}
+
+	template <typename ExecutionPolicy,typename ForwardIterator,typename UnaryPredicate>
+	typename _enable_if_execution_policy<ExecutionPolicy, bool>::type
+		any_of(ExecutionPolicy &&policy, ForwardIterator first, ForwardIterator last, UnaryPredicate pred)
+	{
+		return miniSTL::find_if(std::forward<ExecutionPolicy>(policy), first, last, pred) != last;
+	}
+
+	template <typename ExecutionPolicy,typename ForwardIterator,typename UnaryPredicate>
+	typename _enable_if_execution_policy<ExecutionPolicy, bool>::type
+		none_of(ExecutionPolicy &&policy, ForwardIterator first, ForwardIterator last, UnaryPredicate pred)
+	{
+		return miniSTL::find_if(std::forward<ExecutionPolicy>(policy), first, last, pred) == last;
+	}
+
+	template <typename ExecutionPolicy,typename ForwardIterator,typename UnaryPredicate>
+	typename _enable_if_execution_policy<ExecutionPolicy, bool>::type
+		all_of(ExecutionPolicy &&policy, ForwardIterator first, ForwardIterator last, UnaryPredicate pred)
+	{
+		typedef typename iterator_traits<ForwardIterator>::reference reference;
+		return miniSTL::find_if(std::forward<ExecutionPolicy>(policy), first, last,
+			[pred](reference x) mutable { return !pred(x); }) == last;
+	}
+}
+
+#endif
@@ -1,13 +1,24 @@
 #ifndef _PRIORITY_QUEUE
 #define _PRIORITY_QUEUE
 
+#include "mini_algorithm.h"
+#include "mini_allocator.h"
 #include "mini_functional.h"
 #include "mini_vector.h"
 
+#include <cassert>
+#include <cstddef>
+#include <new>
+#include <utility>
+
 namespace miniSTL
 {
+	/*
+	* priority_queue  Arity ѱԪأĬΪ
+	* ԪغܶࡢȽϺܱʱѡ 4 ѣ³ʱͬһӽڵλͬһУѵĲҲ
+	*/
 	template <typename T,typename Container = miniSTL::vector<T>,
-		typename Compare = miniSTL::less<typename Container::value_type>>
+		typename Compare = miniSTL::less<typename Container::value_type>,size_t Arity = 2>
 	class priority_queue final
 	{
 	public:
@@ -31,8 +42,9 @@ namespace miniSTL
 			const Container &ctnr = Container())
 			: container(ctnr), compare(comp)
 		{
-			container.insert(container.end(), first, last);
-			miniSTL::make_heap(container.begin(), container.end());
+			for (;first != last;++first)
+				container.push_back(*first);
+			miniSTL::make_dary_heap<Arity>(container.begin(), container.end(), compare);
 		}
 
 		bool empty() const
@@ -42,16 +54,17 @@ namespace miniSTL
 
 		size_type size() const { return container.size(); }
 		reference top() { return container.front(); }
+		const_reference top() const { return *container.begin(); }
 
 		void push(const value_type &val)
 		{
 			container.push_back(val);
-			miniSTL::push_heap(container.begin(), container.end(), compare);
+			miniSTL::push_dary_heap<Arity>(container.begin(), container.end(), compare);
 		}
 
 		void pop()
 		{
-			miniSTL::pop_heap(container.begin(), container.end(), compare);
+			miniSTL::pop_dary_heap<Arity>(container.begin(), container.end(), compare);
 			container.pop_back();
 		}
 
@@ -62,15 +75,551 @@ namespace miniSTL
 		}
 
 	public:
-		template <typename T,typename Container,typename Compare>
-		friend void swap(priority_queue<T, Container, Compare> &x, priority_queue<T, Container, Compare> &y);
+		template <typename U,typename C,typename Comp,size_t D>
+		friend void swap(priority_queue<U, C, Comp, D> &x, priority_queue<U, C, Comp, D> &y);
 	};
 
-	template <typename T,typename Container,typename Compare>
-	void swap(priority_queue<T, Container, Compare> &x, priority_queue<T, Container, Compare> &y)
+	template <typename T,typename Container,typename Compare,size_t Arity>
+	void swap(priority_queue<T, Container, Compare, Arity> &x, priority_queue<T, Container, Compare, Arity> &y)
 	{
 		x.swap(y);
 	}
+
+	/*
+	* top_k б Compare  k Ԫ
+	* ڲǶѶΪԪСߵнѣ push_heap ͷıȽϺά
+	* ԪֻѶȽϣ滻ѶʱӶѶĿλֱ³ N ԪصĴΪ O(NlogK)ռΪ O(K)
+	*/
+	template <typename T,typename Compare = miniSTL::less<T>>
+	class top_k final
+	{
+	private:
+		// תȽϷʹѶΪԪСһ
+		struct heap_compare
+		{
+			Compare comp;
+
+			bool operator()(const T &a, const T &b)
+			{
+				return comp(b, a);
+			}
+		};
+
+		vector<T> heap;
+		size_t k;
+		heap_compare compare;
+
+	public:
+		explicit top_k(size_t k, const Compare &comp = Compare())
+			:k(k), compare{ comp }
+		{
+			if (k != 0)
+				heap.reserve(k);
+		}
+
+		size_t size() const { return heap.size(); }
+		bool empty() const { return heap.empty(); }
+		size_t limit() const { return k; }
+
+		// ԪСһʱԪضᱻ
+		const T &threshold() const
+		{
+			assert(!empty());
+			return *heap.begin();
+		}
+
+		void push(const T &value)
+		{
+			if (heap.size() < k)
+			{
+				heap.push_back(value);
+				miniSTL::push_heap(heap.begin(), heap.end(), compare);
+			}
+			else if (k != 0 && compare.comp(*heap.begin(), value))
+			{
+				// ԪشӶѶĿλ³Ǳ̭С
+				_dary_adjust_heap<2>(heap.begin(), ptrdiff_t(0), static_cast<ptrdiff_t>(k), value, compare);
+			}
+		}
+
+		template <typename InputIterator>
+		void push(InputIterator first, InputIterator last)
+		{
+			for (;first != last;++first)
+				push(*first);
+		}
+
+		// ѱԪشӴСд out 
+		template <typename OutputIterator>
+		OutputIterator extract(OutputIterator out)
+		{
+			miniSTL::sort_heap(heap.begin(), heap.end(), compare);
+			for (auto it = heap.begin();it != heap.end();++it, ++out)
+				*out = *it;
+			heap.clear();
+			return out;
+		}
+	};
+
+	/*
+	* indexed_priority_queue Ѱַȶ
+	* push һ֮ͨȡ޸ĻɾԪأظڵĸ
+	* Ԫر Arity Уһλñ¼ÿԪڶе±꣬
+	* Ԫÿƶһξ͸һλñɾԪصľᱻ֮ push ʹ
+	* pushpopupdateerase Ϊ O(logN)top 밴ȡΪ O(1)
+	*/
+	template <typename T,typename Compare = miniSTL::less<T>,size_t Arity = 4>
+	class indexed_priority_queue final
+	{
+	public:
+		typedef T			value_type;
+		typedef size_t		size_type;
+		typedef size_t		handle_type;
+
+	private:
+		struct entry
+		{
+			T value;
+			handle_type handle;
+		};
+
+		struct entry_compare
+		{
+			Compare *comp;
+
+			bool operator()(const entry &a, const entry &b)
+			{
+				return (*comp)(a.value, b.value);
+			}
+		};
+
+		enum : size_t { npos = static_cast<size_t>(-1) };
+
+		vector<entry> heap;
+		vector<size_t> pos; // pos[h] Ϊ h Ԫ heap е±꣬npos ʾδʹ
+		vector<handle_type> free_handles;
+		Compare compare;
+
+	public:
+		explicit indexed_priority_queue(const Compare &comp = Compare()) :compare(comp) {}
+
+		bool empty() const { return heap.empty(); }
+		size_type size() const { return heap.size(); }
+
+		const value_type &top() const
+		{
+			assert(!empty());
+			return heap[0].value;
+		}
+
+		handle_type top_handle() const
+		{
+			assert(!empty());
+			return heap[0].handle;
+		}
+
+		bool contains(handle_type h) const { return h < pos.size() && pos[h] != npos; }
+
+		const value_type &operator[](handle_type h) const
+		{
+			assert(contains(h));
+			return heap[pos[h]].value;
+		}
+
+		handle_type push(const value_type &val)
+		{
+			handle_type h;
+			if (!free_handles.empty())
+			{
+				h = free_handles.back();
+				free_handles.pop_back();
+			}
+			else
+			{
+				h = pos.size();
+				pos.push_back(npos);
+			}
+			heap.push_back(entry{ val, h });
+			sift_up(heap.size() - 1);
+			return h;
+		}
+
+		// ɾѶλؽϴӽڵƵҶӣٰѶβԪش
+		void pop()
+		{
+			assert(!empty());
+			release(heap[0].handle);
+			entry last = std::move(heap.back());
+			heap.pop_back();
+			if (heap.empty())
+				return;
+			const size_t n = heap.size();
+			size_t hole = 0;
+			for (size_t child = 1;child < n;child = Arity * hole + 1)
+			{
+				size_t best = max_child(child, n);
+				place(hole, std::move(heap[best]));
+				hole = best;
+			}
+			heap[hole] = std::move(last);
+			sift_up(hole);
+		}
+
+		// Ѿ h ԪظΪ valֵݻ³
+		void update(handle_type h, const value_type &val)
+		{
+			assert(contains(h));
+			const size_t i = pos[h];
+			const bool up = compare(heap[i].value, val);
+			heap[i].value = val;
+			if (up)
+				sift_up(i);
+			else
+				sift_down(i);
+		}
+
+		/*
+		* Ѿ h ԪظΪѶ val val ԭֵֻ֮
+		*  Compare Ϊ greater Сѣ Dijkstra 㷨ǼСֵ
+		*/
+		void decrease_key(handle_type h, const value_type &val)
+		{
+			assert(contains(h));
+			const size_t i = pos[h];
+			assert(!compare(val, heap[i].value));
+			heap[i].value = val;
+			sift_up(i);
+		}
+
+		void erase(handle_type h)
+		{
+			assert(contains(h));
+			const size_t i = pos[h];
+			release(h);
+			const size_t last = heap.size() - 1;
+			if (i != last)
+			{
+				heap[i] = std::move(heap[last]);
+				pos[heap[i].handle] = i;
+				heap.pop_back();
+				// βԪؿܱԭĸڵҲܱӽڵС
+				if (i != 0 && compare(heap[(i - 1) / Arity].value, heap[i].value))
+					sift_up(i);
+				else
+					sift_down(i);
+			}
+			else
+			{
+				heap.pop_back();
+			}
+		}
+
+		void clear()
+		{
+			heap.clear();
+			pos.clear();
+			free_handles.clear();
+		}
+
+		void reserve(size_type n)
+		{
+			heap.reserve(n);
+			pos.reserve(n);
+		}
+
+	private:
+		void place(size_t i, entry &&e)
+		{
+			heap[i] = std::move(e);
+			pos[heap[i].handle] = i;
+		}
+
+		void release(handle_type h)
+		{
+			pos[h] = npos;
+			free_handles.push_back(h);
+		}
+
+		// child Ϊһӽڵ±꣬ӽڵ±
+		size_t max_child(size_t child, size_t n)
+		{
+			entry_compare comp{ &compare };
+			if (child + Arity <= n)
+				return _dary_max_child<Arity>::select(heap.data(), child, comp);
+			size_t best = child;
+			for (size_t k = child + 1;k < n;++k)
+			{
+				if (compare(heap[best].value, heap[k].value))
+					best = k;
+			}
+			return best;
+		}
+
+		void sift_up(size_t hole)
+		{
+			entry e = std::move(heap[hole]);
+			while (hole > 0)
+			{
+				size_t parent = (hole - 1) / Arity;
+				if (!compare(heap[parent].value, e.value))
+					break;
+				place(hole, std::move(heap[parent]));
+				hole = parent;
+			}
+			place(hole, std::move(e));
+		}
+
+		void sift_down(size_t hole)
+		{
+			const size_t n = heap.size();
+			entry e = std::move(heap[hole]);
+			for (size_t child = Arity * hole + 1;child < n;child = Arity * hole + 1)
+			{
+				size_t best = max_child(child, n);
+				if (!compare(e.value, heap[best].value))
+					break;
+				place(hole, std::move(heap[best]));
+				hole = best;
+			}
+			place(hole, std::move(e));
+		}
+	};
+
+	/*
+	* pairing_heap ԶѣѰַʺƵ decrease_key ĳ
+	* ÿԪһĽڵ㣬push صľǽڵָ룬Ԫرɾ֮ǰһֱЧ
+	* ڵĵһӽڵ child Уֵܽڵ sibling 
+	* prev ָߵֵܣӽڵָ򸸽ڵ㣬κνڵ㶼 O(1) شժ
+	* pushdecrease_keymerge Ϊ O(1)pop  erase ̯ O(logN)
+	* decrease_key ̯ o(logN)ʵʹнӽ
+	* pop ˺ϲȴϲٴҵκϲ
+	*/
+	template <typename T,typename Compare = miniSTL::less<T>>
+	class pairing_heap final
+	{
+	private:
+		struct node
+		{
+			T value;
+			node *child;
+			node *sibling;
+			node *prev;
+
+			explicit node(const T &v) :value(v), child(nullptr), sibling(nullptr), prev(nullptr) {}
+		};
+
+	public:
+		typedef T			value_type;
+		typedef size_t		size_type;
+		typedef node		*handle_type;
+
+	private:
+		node *root;
+		size_t count;
+		Compare compare;
+
+	public:
+		explicit pairing_heap(const Compare &comp = Compare()) :root(nullptr), count(0), compare(comp) {}
+		pairing_heap(pairing_heap &&other) :root(other.root), count(other.count), compare(other.compare)
+		{
+			other.root = nullptr;
+			other.count = 0;
+		}
+		~pairing_heap() { clear(); }
+
+		pairing_heap(const pairing_heap&) = delete;
+		pairing_heap &operator=(const pairing_heap&) = delete;
+
+		bool empty() const { return root == nullptr; }
+		size_type size() const { return count; }
+
+		const value_type &top() const
+		{
+			assert(!empty());
+			return root->value;
+		}
+
+		handle_type top_handle() const
+		{
+			assert(!empty());
+			return root;
+		}
+
+		static const value_type &value(handle_type h) { return h->value; }
+
+		handle_type push(const value_type &val)
+		{
+			node *x = allocator<node>::allocate(1);
+			new(x) node(val);
+			root = meld(root, x);
+			++count;
+			return x;
+		}
+
+		void pop()
+		{
+			assert(!empty());
+			node *old = root;
+			root = merge_pairs(old->child);
+			destroy_node(old);
+		}
+
+		/*
+		* Ѿ h ԪظΪѶ val val ԭֵ֮
+		* ժ h ΪϲO(1)
+		*/
+		void decrease_key(handle_type h, const value_type &val)
+		{
+			assert(!compare(val, h->value));
+			h->value = val;
+			if (h != root)
+			{
+				cut(h);
+				root = meld(root, h);
+			}
+		}
+
+		// Ѿ h ԪظΪ valֵԭֵ֮ʱh Ҫºϲ
+		void update(handle_type h, const value_type &val)
+		{
+			if (!compare(val, h->value))
+			{
+				decrease_key(h, val);
+				return;
+			}
+			node *rest = nullptr;
+			if (h != root)
+			{
+				cut(h);
+				rest = root;
+			}
+			node *children = merge_pairs(h->child);
+			h->child = nullptr;
+			h->value = val;
+			root = meld(meld(rest, children), h);
+		}
+
+		void erase(handle_type h)
+		{
+			if (h == root)
+			{
+				pop();
+				return;
+			}
+			cut(h);
+			root = meld(root, merge_pairs(h->child));
+			destroy_node(h);
+		}
+
+		//  other ԪƵУO(1)other ľȻЧ
+		void merge(pairing_heap &other)
+		{
+			if (this == &other)
+				return;
+			root = meld(root, other.root);
+			count += other.count;
+			other.root = nullptr;
+			other.count = 0;
+		}
+
+		void clear()
+		{
+			//  child sibling Ҫݹջ
+			node *x = root;
+			while (x)
+			{
+				node *c = x->child;
+				if (c)
+				{
+					x->child = c->sibling;
+					c->sibling = x;
+					x = c;
+				}
+				else
+				{
+					node *next = x->sibling;
+					x->~node();
+					allocator<node>::deallocate(x, 1);
+					x = next;
+				}
+			}
+			root = nullptr;
+			count = 0;
+		}
+
+	private:
+		void destroy_node(node *x)
+		{
+			x->~node();
+			allocator<node>::deallocate(x, 1);
+			--count;
+		}
+
+		// ϲab ûֵܵĸСĸΪϴĸӽڵ
+		node *meld(node *a, node *b)
+		{
+			if (!a)
+				return b;
+			if (!b)
+				return a;
+			if (compare(a->value, b->value))
+			{
+				node *t = a;
+				a = b;
+				b = t;
+			}
+			b->sibling = a->child;
+			if (a->child)
+				a->child->prev = b;
+			b->prev = a;
+			a->child = b;
+			return a;
+		}
+
+		//  x ͬժ£x Ǹ
+		void cut(node *x)
+		{
+			if (x->prev->child == x)
+				x->prev->child = x->sibling;
+			else
+				x->prev->sibling = x->sibling;
+			if (x->sibling)
+				x->sibling->prev = x->prev;
+			x->prev = x->sibling = nullptr;
+		}
+
+		// ˺ϲ first ʼֵغϲĸ
+		node *merge_pairs(node *first)
+		{
+			if (!first)
+				return nullptr;
+			// һ˴ϲͨ sibling 
+			node *merged = nullptr;
+			while (first)
+			{
+				node *a = first, *b = first->sibling;
+				first = b ? b->sibling : nullptr;
+				a->prev = a->sibling = nullptr;
+				if (b)
+					b->prev = b->sibling = nullptr;
+				node *m = meld(a, b);
+				m->sibling = merged;
+				merged = m;
+			}
+			// ڶ˴ҵκϲ
+			node *result = merged;
+			merged = merged->sibling;
+			result->sibling = nullptr;
+			while (merged)
+			{
+				node *next = merged->sibling;
+				merged->sibling = nullptr;
+				result = meld(result, merged);
+				merged = next;
+			}
+			return result;
+		}
+	};
 }
 
 
@@ -0,0 +1,168 @@
+/*
+* ļʵ CPU Լ⼰ mini_simd.h  AVX2 汾
+* AVX2 ֻڱļ AVX2 ָ룬벻Ӱ
+*/
+#include "mini_simd.h"
+
+#if defined(MINI_HAS_SSE2) && (defined(_MSC_VER) || defined(__GNUC__))
+#define MINI_HAS_AVX2_KERNELS 1
+#include <immintrin.h>
+#ifdef _MSC_VER
+#define MINI_TARGET_AVX2
+#else
+#include <cpuid.h>
+#define MINI_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+#endif
+
+namespace miniSTL
+{
+	namespace simd
+	{
+		namespace
+		{
+#ifdef MINI_HAS_AVX2_KERNELS
+			void cpuid(unsigned leaf, unsigned subleaf, unsigned regs[4])
+			{
+#ifdef _MSC_VER
+				int r[4];
+				__cpuidex(r, static_cast<int>(leaf), static_cast<int>(subleaf));
+				for (int i = 0;i != 4;++i)
+					regs[i] = static_cast<unsigned>(r[i]);
+#else
+				__cpuid_count(leaf, subleaf, regs[0], regs[1], regs[2], regs[3]);
+#endif
+			}
+
+			// ȡ XCR0жϲϵͳǷлʱ YMM Ĵ
+			unsigned long long read_xcr0()
+			{
+#ifdef _MSC_VER
+				return _xgetbv(0);
+#else
+				unsigned eax, edx;
+				__asm__ __volatile__("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+				return (static_cast<unsigned long long>(edx) << 32) | eax;
+#endif
+			}
+
+			bool detect_avx2()
+			{
+				unsigned regs[4];
+				cpuid(0, 0, regs);
+				if (regs[0] < 7)
+					return false;
+				cpuid(1, 0, regs);
+				const unsigned osxsave = 1u << 27, avx = 1u << 28;
+				if ((regs[2] & (osxsave | avx)) != (osxsave | avx))
+					return false;
+				if ((read_xcr0() & 6) != 6)
+					return false;
+				cpuid(7, 0, regs);
+				return (regs[1] & (1u << 5)) != 0;
+			}
+
+			// Ԫؿѡ AVX2 ָȵԪضӦֽȫ 1
+			template <size_t Bytes>
+			struct avx2_lanes;
+
+			template <>
+			struct avx2_lanes<1>
+			{
+				MINI_TARGET_AVX2 static __m256i set1(uint8_t v) { return _mm256_set1_epi8(static_cast<char>(v)); }
+				MINI_TARGET_AVX2 static __m256i cmpeq(__m256i a, __m256i b) { return _mm256_cmpeq_epi8(a, b); }
+			};
+
+			template <>
+			struct avx2_lanes<2>
+			{
+				MINI_TARGET_AVX2 static __m256i set1(uint16_t v) { return _mm256_set1_epi16(static_cast<short>(v)); }
+				MINI_TARGET_AVX2 static __m256i cmpeq(__m256i a, __m256i b) { return _mm256_cmpeq_epi16(a, b); }
+			};
+
+			template <>
+			struct avx2_lanes<4>
+			{
+				MINI_TARGET_AVX2 static __m256i set1(uint32_t v) { return _mm256_set1_epi32(static_cast<int>(v)); }
+				MINI_TARGET_AVX2 static __m256i cmpeq(__m256i a, __m256i b) { return _mm256_cmpeq_epi32(a, b); }
+			};
+
+			template <>
+			struct avx2_lanes<8>
+			{
+				MINI_TARGET_AVX2 static __m256i set1(uint64_t v) { return _mm256_set1_epi64x(static_cast<long long>(v)); }
+				MINI_TARGET_AVX2 static __m256i cmpeq(__m256i a, __m256i b) { return _mm256_cmpeq_epi64(a, b); }
+			};
+
+			template <typename U>
+			MINI_TARGET_AVX2 size_t find_avx2(const U *p, size_t n, U v)
+			{
+				typedef avx2_lanes<sizeof(U)> lanes;
+				const size_t per_block = 32 / sizeof(U);
+				const __m256i needle = lanes::set1(v);
+				size_t i = 0;
+				// ÿαȽ 128 ֽڣк 32 ֽڿ鶨λ
+				for (;i + 4 * per_block <= n;i += 4 * per_block)
+				{
+					__m256i b0 = lanes::cmpeq(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i)), needle);
+					__m256i b1 = lanes::cmpeq(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i + per_block)), needle);
+					__m256i b2 = lanes::cmpeq(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i + 2 * per_block)), needle);
+					__m256i b3 = lanes::cmpeq(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i + 3 * per_block)), needle);
+					__m256i any = _mm256_or_si256(_mm256_or_si256(b0, b1), _mm256_or_si256(b2, b3));
+					if (!_mm256_testz_si256(any, any))
+						break;
+				}
+				for (;i + per_block <= n;i += per_block)
+				{
+					__m256i eq = lanes::cmpeq(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i)), needle);
+					unsigned mask = static_cast<unsigned>(_mm256_movemask_epi8(eq));
+					if (mask != 0)
+						return i + count_trailing_zeros(mask) / sizeof(U);
+				}
+				// ʣ಻ 32 ֽڣ SSE2 汾
+				return i + find_value_sse2(p + i, n - i, v);
+			}
+
+			template <typename U>
+			MINI_TARGET_AVX2 size_t count_avx2(const U *p, size_t n, U v)
+			{
+				typedef avx2_lanes<sizeof(U)> lanes;
+				const size_t per_block = 32 / sizeof(U);
+				const __m256i needle = lanes::set1(v);
+				size_t i = 0, bits = 0;
+				// ÿȵԪй sizeof(U)  1
+				for (;i + per_block <= n;i += per_block)
+				{
+					__m256i eq = lanes::cmpeq(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i)), needle);
+					bits += popcount(static_cast<unsigned>(_mm256_movemask_epi8(eq)));
+				}
+				return bits / sizeof(U) + count_value_sse2(p + i, n - i, v);
+			}
+#else
+			bool detect_avx2() { return false; }
+
+			// û AVX2 汾ʱᱻѡУΪ
+			template <typename U>
+			size_t find_avx2(const U *p, size_t n, U v) { return find_value_sse2(p, n, v); }
+
+			template <typename U>
+			size_t count_avx2(const U *p, size_t n, U v) { return count_value_sse2(p, n, v); }
+#endif
+		}
+
+		bool cpu_has_avx2()
+		{
+			static const bool has_avx2 = detect_avx2();
+			return has_avx2;
+		}
+
+		size_t find_value_avx2(const uint8_t *p, size_t n, uint8_t v) { return find_avx2(p, n, v); }
+		size_t find_value_avx2(const uint16_t *p, size_t n, uint16_t v) { return find_avx2(p, n, v); }
+		size_t find_value_avx2(const uint32_t *p, size_t n, uint32_t v) { return find_avx2(p, n, v); }
+		size_t find_value_avx2(const uint64_t *p, size_t n, uint64_t v) { return find_avx2(p, n, v); }
+		size_t count_value_avx2(const uint8_t *p, size_t n, uint8_t v) { return count_avx2(p, n, v); }
+		size_t count_value_avx2(const uint16_t *p, size_t n, uint16_t v) { return count_avx2(p, n, v); }
+		size_t count_value_avx2(const uint32_t *p, size_t n, uint32_t v) { return count_avx2(p, n, v); }
+		size_t count_value_avx2(const uint64_t *p, size_t n, uint64_t v) { return count_avx2(p, n, v); }
+	}
+}
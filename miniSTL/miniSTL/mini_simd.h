@@ -0,0 +1,525 @@
+#ifndef _SIMD_H
+#define _SIMD_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+/*
+* SIMD صĵײ㹤ߺ stringstring_view㷨ļȡʹ
+* ͷļеʵʹ SSE2x86-64 ǿãƽ̨˻Ϊʵ
+* AVX2 汾 mini_simd.cpp е룬ʱ CPU Ƿ֧ѡ
+* ͬһִļڲ֧ AVX2 Ļ
+* ûһ㲻ӦֱӰͷļ
+*/
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define MINI_HAS_SSE2 1
+#include <emmintrin.h>
+#endif
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+namespace miniSTL
+{
+	namespace simd
+	{
+		//  mask λ 1 ڵλãmask Ϊ 0
+		inline unsigned count_trailing_zeros(unsigned mask)
+		{
+#ifdef _MSC_VER
+			unsigned long index;
+			_BitScanForward(&index, mask);
+			return static_cast<unsigned>(index);
+#else
+			return static_cast<unsigned>(__builtin_ctz(mask));
+#endif
+		}
+
+		inline unsigned count_trailing_zeros64(unsigned long long mask)
+		{
+#if defined(_MSC_VER) && defined(_M_X64)
+			unsigned long index;
+			_BitScanForward64(&index, mask);
+			return static_cast<unsigned>(index);
+#elif defined(_MSC_VER)
+			unsigned low = static_cast<unsigned>(mask);
+			return low != 0 ? count_trailing_zeros(low) : 32 + count_trailing_zeros(static_cast<unsigned>(mask >> 32));
+#else
+			return static_cast<unsigned>(__builtin_ctzll(mask));
+#endif
+		}
+
+		// ʾ CPU  p ڵĻԤȡУp ЧʱҲ쳣
+		inline void prefetch(const void *p)
+		{
+#ifdef MINI_HAS_SSE2
+			_mm_prefetch(static_cast<const char*>(p), _MM_HINT_T0);
+#elif defined(__GNUC__)
+			__builtin_prefetch(p);
+#else
+			(void)p;
+#endif
+		}
+
+		/*
+		*  [first,last) вֽ cҲʱ last
+		* ÿεȽ 64 ֽڣк 16 ֽڿ鶨λ
+		*/
+		inline const char *find_byte(const char *first, const char *last, char c)
+		{
+#ifdef MINI_HAS_SSE2
+			const __m128i needle = _mm_set1_epi8(c);
+			while (last - first >= 64)
+			{
+				__m128i b0 = _mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(first)), needle);
+				__m128i b1 = _mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(first + 16)), needle);
+				__m128i b2 = _mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(first + 32)), needle);
+				__m128i b3 = _mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(first + 48)), needle);
+				__m128i any = _mm_or_si128(_mm_or_si128(b0, b1), _mm_or_si128(b2, b3));
+				if (_mm_movemask_epi8(any) != 0)
+					break;
+				first += 64;
+			}
+			while (last - first >= 16)
+			{
+				__m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first));
+				unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(block, needle)));
+				if (mask != 0)
+					return first + count_trailing_zeros(mask);
+				first += 16;
+			}
+#endif
+			for (;first != last;++first)
+			{
+				if (*first == c)
+					return first;
+			}
+			return last;
+		}
+
+		/*
+		*  [first,last) в valueT Ϊ 12  4 ֽڵַͣҲʱ last
+		* ֽڽ find_byteַÿαȽ 16 ֽ
+		*/
+		template <typename T>
+		inline const T *find_unit(const T *first, const T *last, T value)
+		{
+			if (sizeof(T) == 1)
+			{
+				const char *p = reinterpret_cast<const char*>(first);
+				return first + (find_byte(p, p + (last - first), static_cast<char>(value)) - p);
+			}
+#ifdef MINI_HAS_SSE2
+			if (sizeof(T) == 2 || sizeof(T) == 4)
+			{
+				const size_t per_block = 16 / sizeof(T);
+				const __m128i needle = sizeof(T) == 2 ? _mm_set1_epi16(static_cast<short>(value))
+					: _mm_set1_epi32(static_cast<int>(value));
+				while (static_cast<size_t>(last - first) >= per_block)
+				{
+					__m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first));
+					__m128i eq = sizeof(T) == 2 ? _mm_cmpeq_epi16(block, needle) : _mm_cmpeq_epi32(block, needle);
+					unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(eq));
+					if (mask != 0)
+						return first + count_trailing_zeros(mask) / sizeof(T);
+					first += per_block;
+				}
+			}
+#endif
+			for (;first != last;++first)
+			{
+				if (*first == value)
+					return first;
+			}
+			return last;
+		}
+
+		/*
+		*  [first,last) вҵһַ [set,set+n) ֽڣҲʱ last
+		* ϲ 8 ַʱÿַһ SIMD Ƚٺϲ
+		* ļʹ 256 λĲұֽж
+		*/
+		inline const char *find_any_of(const char *first, const char *last, const char *set, size_t n)
+		{
+			if (n == 0)
+				return last;
+			if (n == 1)
+				return find_byte(first, last, set[0]);
+#ifdef MINI_HAS_SSE2
+			if (n <= 8)
+			{
+				__m128i needles[8];
+				for (size_t k = 0;k != n;++k)
+					needles[k] = _mm_set1_epi8(set[k]);
+				while (last - first >= 16)
+				{
+					__m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first));
+					__m128i hit = _mm_cmpeq_epi8(block, needles[0]);
+					for (size_t k = 1;k != n;++k)
+						hit = _mm_or_si128(hit, _mm_cmpeq_epi8(block, needles[k]));
+					unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(hit));
+					if (mask != 0)
+						return first + count_trailing_zeros(mask);
+					first += 16;
+				}
+			}
+#endif
+			unsigned char table[32];
+			memset(table, 0, sizeof(table));
+			for (size_t k = 0;k != n;++k)
+			{
+				unsigned char c = static_cast<unsigned char>(set[k]);
+				table[c >> 3] |= static_cast<unsigned char>(1u << (c & 7));
+			}
+			for (;first != last;++first)
+			{
+				unsigned char c = static_cast<unsigned char>(*first);
+				if (table[c >> 3] & (1u << (c & 7)))
+					return first;
+			}
+			return last;
+		}
+
+		/*
+		*  lhs  rhs ǰ n ֽеһȵλãȫʱ n
+		* ÿεȽ 64 ֽڣβ 16 ֽʱ˵ 16 ֽصȽ
+		*/
+		inline size_t mismatch_bytes(const void *lhs, const void *rhs, size_t n)
+		{
+			const char *a = static_cast<const char*>(lhs);
+			const char *b = static_cast<const char*>(rhs);
+			size_t i = 0;
+#ifdef MINI_HAS_SSE2
+			if (n >= 16)
+			{
+				for (;i + 64 <= n;i += 64)
+				{
+					__m128i e0 = _mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i)),
+						_mm_loadu_si128(reinterpret_cast<const __m128i*>(b + i)));
+					__m128i e1 = _mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i + 16)),
+						_mm_loadu_si128(reinterpret_cast<const __m128i*>(b + i + 16)));
+					__m128i e2 = _mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i + 32)),
+						_mm_loadu_si128(reinterpret_cast<const __m128i*>(b + i + 32)));
+					__m128i e3 = _mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i + 48)),
+						_mm_loadu_si128(reinterpret_cast<const __m128i*>(b + i + 48)));
+					__m128i all = _mm_and_si128(_mm_and_si128(e0, e1), _mm_and_si128(e2, e3));
+					if (_mm_movemask_epi8(all) != 0xFFFF)
+						break;
+				}
+				for (;i + 16 <= n;i += 16)
+				{
+					__m128i eq = _mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i)),
+						_mm_loadu_si128(reinterpret_cast<const __m128i*>(b + i)));
+					unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(eq)) ^ 0xFFFFu;
+					if (mask != 0)
+						return i + count_trailing_zeros(mask);
+				}
+				if (i != n)
+				{
+					// [n-16,i) ȷȣһȵλñضС i
+					__m128i eq = _mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(a + n - 16)),
+						_mm_loadu_si128(reinterpret_cast<const __m128i*>(b + n - 16)));
+					unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(eq)) ^ 0xFFFFu;
+					return mask != 0 ? n - 16 + count_trailing_zeros(mask) : n;
+				}
+				return n;
+			}
+#endif
+			for (;i != n;++i)
+			{
+				if (a[i] != b[i])
+					return i;
+			}
+			return n;
+		}
+
+		//  mask  1 ĸ
+		inline unsigned popcount(unsigned mask)
+		{
+#ifdef __GNUC__
+			return static_cast<unsigned>(__builtin_popcount(mask));
+#else
+			// __popcnt Ҫ POPCNT ָܼٶһ
+			mask = mask - ((mask >> 1) & 0x55555555u);
+			mask = (mask & 0x33333333u) + ((mask >> 2) & 0x33333333u);
+			return (((mask + (mask >> 4)) & 0x0F0F0F0Fu) * 0x01010101u) >> 24;
+#endif
+		}
+
+		// ʱ CPU ϵͳǷ֧ AVX2ֻڵһεʱ
+		bool cpu_has_avx2();
+
+		// 䳤Сڸֵʱл AVX2ʡȥ 256 λĴ
+		enum { AVX2_MIN_BYTES = 64 };
+
+		/*
+		* º [p,p+n) вһͳ v λȵԪأԪΪ 124  8 ֽڵ޷
+		*  _avx2 ׺İ汾 mini_simd.cpp Уֻ cpu_has_avx2() Ϊ true ʱ
+		*/
+		size_t find_value_avx2(const uint8_t *p, size_t n, uint8_t v);
+		size_t find_value_avx2(const uint16_t *p, size_t n, uint16_t v);
+		size_t find_value_avx2(const uint32_t *p, size_t n, uint32_t v);
+		size_t find_value_avx2(const uint64_t *p, size_t n, uint64_t v);
+		size_t count_value_avx2(const uint8_t *p, size_t n, uint8_t v);
+		size_t count_value_avx2(const uint16_t *p, size_t n, uint16_t v);
+		size_t count_value_avx2(const uint32_t *p, size_t n, uint32_t v);
+		size_t count_value_avx2(const uint64_t *p, size_t n, uint64_t v);
+
+#ifdef MINI_HAS_SSE2
+		// Ԫؿѡ SSE2 ָȵԪضӦֽȫ 1
+		template <size_t Bytes>
+		struct sse2_lanes;
+
+		template <>
+		struct sse2_lanes<1>
+		{
+			static __m128i set1(uint8_t v) { return _mm_set1_epi8(static_cast<char>(v)); }
+			static __m128i cmpeq(__m128i a, __m128i b) { return _mm_cmpeq_epi8(a, b); }
+		};
+
+		template <>
+		struct sse2_lanes<2>
+		{
+			static __m128i set1(uint16_t v) { return _mm_set1_epi16(static_cast<short>(v)); }
+			static __m128i cmpeq(__m128i a, __m128i b) { return _mm_cmpeq_epi16(a, b); }
+		};
+
+		template <>
+		struct sse2_lanes<4>
+		{
+			static __m128i set1(uint32_t v) { return _mm_set1_epi32(static_cast<int>(v)); }
+			static __m128i cmpeq(__m128i a, __m128i b) { return _mm_cmpeq_epi32(a, b); }
+		};
+
+		template <>
+		struct sse2_lanes<8>
+		{
+			static __m128i set1(uint64_t v)
+			{
+				return _mm_set_epi32(static_cast<int>(v >> 32), static_cast<int>(v),
+					static_cast<int>(v >> 32), static_cast<int>(v));
+			}
+
+			// SSE2 û 64 λȽϣ 32 λ߶Ȳ
+			static __m128i cmpeq(__m128i a, __m128i b)
+			{
+				__m128i eq = _mm_cmpeq_epi32(a, b);
+				return _mm_and_si128(eq, _mm_shuffle_epi32(eq, _MM_SHUFFLE(2, 3, 0, 1)));
+			}
+		};
+#endif
+
+		template <typename U>
+		inline size_t find_value_sse2(const U *p, size_t n, U v)
+		{
+			size_t i = 0;
+#ifdef MINI_HAS_SSE2
+			typedef sse2_lanes<sizeof(U)> lanes;
+			const size_t per_block = 16 / sizeof(U);
+			const __m128i needle = lanes::set1(v);
+			// ÿαȽ 64 ֽڣк 16 ֽڿ鶨λ
+			for (;i + 4 * per_block <= n;i += 4 * per_block)
+			{
+				__m128i b0 = lanes::cmpeq(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i)), needle);
+				__m128i b1 = lanes::cmpeq(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i + per_block)), needle);
+				__m128i b2 = lanes::cmpeq(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i + 2 * per_block)), needle);
+				__m128i b3 = lanes::cmpeq(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i + 3 * per_block)), needle);
+				__m128i any = _mm_or_si128(_mm_or_si128(b0, b1), _mm_or_si128(b2, b3));
+				if (_mm_movemask_epi8(any) != 0)
+					break;
+			}
+			for (;i + per_block <= n;i += per_block)
+			{
+				__m128i eq = lanes::cmpeq(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i)), needle);
+				unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(eq));
+				if (mask != 0)
+					return i + count_trailing_zeros(mask) / sizeof(U);
+			}
+#endif
+			for (;i != n;++i)
+			{
+				if (p[i] == v)
+					return i;
+			}
+			return n;
+		}
+
+		template <typename U>
+		inline size_t count_value_sse2(const U *p, size_t n, U v)
+		{
+			size_t i = 0, bits = 0;
+#ifdef MINI_HAS_SSE2
+			typedef sse2_lanes<sizeof(U)> lanes;
+			const size_t per_block = 16 / sizeof(U);
+			const __m128i needle = lanes::set1(v);
+			// ÿȵԪй sizeof(U)  1
+			for (;i + per_block <= n;i += per_block)
+			{
+				__m128i eq = lanes::cmpeq(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i)), needle);
+				bits += popcount(static_cast<unsigned>(_mm_movemask_epi8(eq)));
+			}
+#endif
+			size_t result = bits / sizeof(U);
+			for (;i != n;++i)
+			{
+				if (p[i] == v)
+					++result;
+			}
+			return result;
+		}
+
+		// صһ v ȵԪص±꣬Ҳʱ nֱֽʹ memchr
+		template <typename U>
+		inline size_t find_value(const U *p, size_t n, U v)
+		{
+			//  p ǿָ룬ܴ memchr
+			if (n == 0)
+				return 0;
+			if (sizeof(U) == 1)
+			{
+				const void *pos = memchr(p, static_cast<int>(v), n);
+				return pos ? static_cast<const U*>(pos) - p : n;
+			}
+			if (n * sizeof(U) >= AVX2_MIN_BYTES && cpu_has_avx2())
+				return find_value_avx2(p, n, v);
+			return find_value_sse2(p, n, v);
+		}
+
+		//  v ȵԪظ
+		template <typename U>
+		inline size_t count_value(const U *p, size_t n, U v)
+		{
+			if (n * sizeof(U) >= AVX2_MIN_BYTES && cpu_has_avx2())
+				return count_value_avx2(p, n, v);
+			return count_value_sse2(p, n, v);
+		}
+
+		/*
+		*  [a,a+na)  [b,b+nb) Ľ a е˳д outдĸ
+		*  set_intersection ֵͬ x ߷ֱ mn ʱ min(m,n) 
+		* ÿȡ߸ 4 Ԫأ b  4 Ԫת a Ƚϣһ 16 αȽϣ
+		* ֵٰǰһ
+		* 4 ԪͬһԪϸʱڵÿֵ߶ֻһΣSIMD ȽϵĽȷ
+		* 򣨿ظԪأһ˻鲢
+		* out Ҫ min(na,nb) ԪأҲ ab ص
+		*/
+		inline size_t intersect_sorted_u32(const uint32_t *a, size_t na, const uint32_t *b, size_t nb, uint32_t *out)
+		{
+			size_t i = 0, j = 0, k = 0;
+#ifdef MINI_HAS_SSE2
+			// ҪȡһԪظҪʣ 5 
+			while (i + 4 < na && j + 4 < nb)
+			{
+				const __m128i va = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i));
+				const __m128i vb = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + j));
+				__m128i dup = _mm_or_si128(
+					_mm_cmpeq_epi32(va, _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i + 1))),
+					_mm_cmpeq_epi32(vb, _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + j + 1))));
+				if (_mm_movemask_epi8(dup) != 0)
+				{
+					// 鲢ֱĳһԽǰ
+					const size_t i_end = i + 4, j_end = j + 4;
+					while (i != i_end && j != j_end)
+					{
+						if (a[i] < b[j])
+						{
+							++i;
+						}
+						else if (b[j] < a[i])
+						{
+							++j;
+						}
+						else
+						{
+							out[k++] = a[i];
+							++i, ++j;
+						}
+					}
+					continue;
+				}
+				__m128i eq = _mm_cmpeq_epi32(va, vb);
+				eq = _mm_or_si128(eq, _mm_cmpeq_epi32(va, _mm_shuffle_epi32(vb, _MM_SHUFFLE(0, 3, 2, 1))));
+				eq = _mm_or_si128(eq, _mm_cmpeq_epi32(va, _mm_shuffle_epi32(vb, _MM_SHUFFLE(1, 0, 3, 2))));
+				eq = _mm_or_si128(eq, _mm_cmpeq_epi32(va, _mm_shuffle_epi32(vb, _MM_SHUFFLE(2, 1, 0, 3))));
+				unsigned mask = static_cast<unsigned>(_mm_movemask_ps(_mm_castsi128_ps(eq)));
+				while (mask != 0)
+				{
+					out[k++] = a[i + count_trailing_zeros(mask)];
+					mask &= mask - 1;
+				}
+				const uint32_t a_max = a[i + 3], b_max = b[j + 3];
+				if (a_max <= b_max)
+					i += 4;
+				if (b_max <= a_max)
+					j += 4;
+			}
+#endif
+			while (i != na && j != nb)
+			{
+				if (a[i] < b[j])
+				{
+					++i;
+				}
+				else if (b[j] < a[i])
+				{
+					++j;
+				}
+				else
+				{
+					out[k++] = a[i];
+					++i, ++j;
+				}
+			}
+			return k;
+		}
+
+#ifdef MINI_HAS_SSE2
+		// ѼĴе 'A'~'Z' תΪСдֽڲ
+		inline __m128i to_lower_ascii(__m128i v)
+		{
+			// ƽƺ 'A'~'Z' зС 26 ֵϣһαȽϼɵõ
+			const __m128i shifted = _mm_add_epi8(v, _mm_set1_epi8(static_cast<char>(0x80 - 'A')));
+			const __m128i upper = _mm_cmplt_epi8(shifted, _mm_set1_epi8(static_cast<char>(0x80 + 26)));
+			return _mm_or_si128(v, _mm_and_si128(upper, _mm_set1_epi8(0x20)));
+		}
+#endif
+
+		/*
+		*  [first,last) ͷ ASCII ֽڣصһλΪ 1 ֽڣȫ ASCII ʱ last
+		* ÿε 64 ֽ
+		*/
+		inline const char *skip_ascii(const char *first, const char *last)
+		{
+#ifdef MINI_HAS_SSE2
+			while (last - first >= 64)
+			{
+				__m128i b0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first));
+				__m128i b1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first + 16));
+				__m128i b2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first + 32));
+				__m128i b3 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first + 48));
+				__m128i any = _mm_or_si128(_mm_or_si128(b0, b1), _mm_or_si128(b2, b3));
+				if (_mm_movemask_epi8(any) != 0)
+					break;
+				first += 64;
+			}
+			while (last - first >= 16)
+			{
+				unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(first))));
+				if (mask != 0)
+					return first + count_trailing_zeros(mask);
+				first += 16;
+			}
+#endif
+			for (;first != last;++first)
+			{
+				if (static_cast<unsigned char>(*first) >= 0x80)
+					return first;
+			}
+			return last;
+		}
+	}
+}
+
+#endif
@@ -0,0 +1,106 @@
+#ifndef _SPLIT_H
+#define _SPLIT_H
+
+#include "mini_iterator.h"
+#include "mini_simd.h"
+#include "mini_string_view.h"
+
+namespace miniSTL
+{
+	/*
+	* Եַз
+	* split(sv, delims)  delims еһַз svθÿֶε string_view
+	* ̲ڴ棻ֶָ sv ĵײݣʹ豣֤Ч
+	* ĬϱֶΣ"a,,b," зΪ "a" "" "b" ""skip_empty Ϊ true ʱֶ
+	* tokenize(sv, delims) ȼֶε splitȡɷǷָɵƬ
+	*/
+	class split_iterator : public iterator<forward_iterator_tag, string_view>
+	{
+	private:
+		const char *next_field; // һֶεʼλãΪָʾûиֶ
+		const char *last;
+		string_view delims;
+		string_view field; // ǰֶ
+		bool skip_empty;
+
+	public:
+		split_iterator() :next_field(nullptr), last(nullptr), skip_empty(false) {}
+		split_iterator(string_view sv, string_view delims, bool skip_empty)
+			:next_field(sv.data() ? sv.data() : ""), last(next_field + sv.size()),
+			delims(delims), skip_empty(skip_empty)
+		{
+			advance();
+		}
+
+		const string_view &operator*() const { return field; }
+		const string_view *operator->() const { return &field; }
+
+		split_iterator &operator++()
+		{
+			advance();
+			return *this;
+		}
+
+		split_iterator operator++(int)
+		{
+			auto result = *this;
+			advance();
+			return result;
+		}
+
+		// н״̬ĵȣ򰴵ǰֶελñȽ
+		bool operator==(const split_iterator &other) const
+		{
+			if (last == nullptr || other.last == nullptr)
+				return last == other.last;
+			return field.data() == other.field.data() && next_field == other.next_field;
+		}
+
+		bool operator!=(const split_iterator &other) const { return !(*this == other); }
+
+	private:
+		void advance()
+		{
+			for (;;)
+			{
+				if (next_field == nullptr)
+				{
+					last = nullptr;
+					return;
+				}
+				const char *pos = simd::find_any_of(next_field, last, delims.data(), delims.size());
+				field = string_view(next_field, pos - next_field);
+				next_field = (pos == last) ? nullptr : pos + 1;
+				if (!skip_empty || !field.empty())
+					return;
+			}
+		}
+	};
+
+	class split_range
+	{
+	private:
+		string_view sv;
+		string_view delims;
+		bool skip_empty;
+
+	public:
+		split_range(string_view sv, string_view delims, bool skip_empty)
+			:sv(sv), delims(delims), skip_empty(skip_empty) {}
+
+		split_iterator begin() const { return split_iterator(sv, delims, skip_empty); }
+		split_iterator end() const { return split_iterator(); }
+	};
+
+	inline split_range split(string_view sv, string_view delims, bool skip_empty = false)
+	{
+		return split_range(sv, delims, skip_empty);
+	}
+
+	inline split_range tokenize(string_view sv, string_view delims = " \t\r\n")
+	{
+		return split_range(sv, delims, true);
+	}
+}
+
+#endif
@@ -2,59 +2,75 @@
 #define _STRING_H
 
 #include "mini_allocator.h"
+#include "mini_char_traits.h"
+#include "mini_hash.h"
 #include "mini_reverse_iterator.h"
+#include "mini_simd.h"
+#include "mini_string_view.h"
 #include "mini_uninitialized_functions.h"
 #include "mini_utility.h"
 #include "mini_type_traits.h"
 
 #include <cstring>
+#include <iosfwd>
 #include <type_traits>
 
 namespace miniSTL
 {
-	class string final
+	/*
+	* basic_string<CharT, Traits, Alloc>stringwstringu16stringu32string ʵ
+	* ַĿȽҶ Traits ɣchar_traits жӦ memcpy/memmoveSIMD  memchr
+	* ˿ַ string ͬһ׷ҵĿ·
+	*/
+	template <typename CharT, typename Traits = char_traits<CharT>, typename Alloc = allocator<CharT>>
+	class basic_string final
 	{
 	public:
-		typedef char							value_type;
-		typedef char*							iterator;
-		typedef const char*						const_iterator;
-		typedef reverse_iterator_t<char*>		reverse_iterator;
-		typedef reverse_iterator_t<const char*> const_reverse_iterator;
-		typedef value_type&						reference;
-		typedef const value_type&				const_reference;
-		typedef size_t							size_type;
-		typedef ptrdiff_t						difference_type;
+		typedef Traits								traits_type;
+		typedef Alloc								allocator_type;
+		typedef CharT								value_type;
+		typedef CharT*								iterator;
+		typedef const CharT*						const_iterator;
+		typedef reverse_iterator_t<CharT*>			reverse_iterator;
+		typedef reverse_iterator_t<const CharT*>	const_reverse_iterator;
+		typedef value_type&							reference;
+		typedef const value_type&					const_reference;
+		typedef size_t								size_type;
+		typedef ptrdiff_t							difference_type;
+		typedef basic_string_view<CharT, Traits>	string_view_type;
 		// npos ʾຬеַ
 		static const size_t npos = -1;
 
 	private:
-		char *start;
-		char *finish;
-		char *end_of_storage;
+		CharT *start;
+		CharT *finish;
+		CharT *end_of_storage;
 
-		typedef miniSTL::allocator<char> data_allocator;
+		typedef Alloc data_allocator;
 
 	public:
-		string():start(nullptr),finish(nullptr),end_of_storage(nullptr){}
-		string(const string &str);
-		string(string &&str);
-		string(const string &str, size_t pos, size_t len = npos);
-		string(const char *s);
-		string(const char *s, size_t n);
-		string(size_t n, char c);
+		basic_string():start(nullptr),finish(nullptr),end_of_storage(nullptr){}
+		basic_string(const basic_string &str);
+		basic_string(basic_string &&str);
+		basic_string(const basic_string &str, size_t pos, size_t len = npos);
+		basic_string(const CharT *s);
+		basic_string(const CharT *s, size_t n);
+		basic_string(size_t n, CharT c);
+		//  string_view ʽУֻڵҪʱ
+		explicit basic_string(string_view_type sv);
 		
 		template <typename InputIterator>
-		string(InputIterator first, InputIterator last)
+		basic_string(InputIterator first, InputIterator last)
 		{
 			allocate_and_copy(first, last);
 		}
 
-		string &operator=(const string &str);
-		string &operator=(string &&str);
-		string &operator=(const char *s);
-		string &operator=(char ch);
+		basic_string &operator=(const basic_string &str);
+		basic_string &operator=(basic_string &&str);
+		basic_string &operator=(const CharT *s);
+		basic_string &operator=(CharT ch);
 
-		~string();
+		~basic_string();
 
 		iterator begin() { return start; }
 		const_iterator begin() const { return start; }
@@ -66,26 +82,30 @@ namespace miniSTL
 		const_reverse_iterator rbegin() const { return const_reverse_iterator(finish); }
 
 		reverse_iterator rend() { return reverse_iterator(start); }
-		reverse_iterator rend() const { return reverse_iterator(start); }
+		const_reverse_iterator rend() const { return const_reverse_iterator(start); }
 
 		const_iterator cbegin() const { return start; }
 		const_iterator cend() const { return finish; }
 		const_reverse_iterator crbegin() const { return const_reverse_iterator(finish); }
 		const_reverse_iterator crend() const { return const_reverse_iterator(start); }
+
+		const CharT *data() const { return start; }
+		operator string_view_type() const { return string_view_type(start, size()); }
 		
 		size_t size() const { return finish - start; }
 		size_t length() const { return size(); }
 		size_t capacity() const { return end_of_storage - start; }
 
+		// ֻóȣѷĿռ䣬Ϊַ
 		void clear()
 		{
 			data_allocator::destroy(start, finish);
-			start = finish;
+			finish = start;
 		}
 
 		bool empty() const { return start == finish; }
 		void resize(size_t n);
-		void resize(size_t n, char ch);
+		void resize(size_t n, CharT ch);
 		void reserve(size_t n = 0);
 		void shrink_to_fit()
 		{
@@ -93,119 +113,142 @@ namespace miniSTL
 			end_of_storage = finish;
 		}
 
-		char &operator[](size_t pos) { return *(start + pos); }
-		const char &operator[](size_t pos) const { return *(start + pos); }
+		CharT &operator[](size_t pos) { return *(start + pos); }
+		const CharT &operator[](size_t pos) const { return *(start + pos); }
 
-		char &back() { return *(finish - 1); }
-		const char &back() const { return *(finish - 1); }
+		CharT &back() { return *(finish - 1); }
+		const CharT &back() const { return *(finish - 1); }
 
-		char &front() { return *start; }
-		const char &front() const { return *start; }
+		CharT &front() { return *start; }
+		const CharT &front() const { return *start; }
 
-		string &insert(size_t pos, const string &str);
-		string &insert(size_t pos, const string &str, size_t subpos, size_t sublen = npos);
-		string &insert(size_t pos, const char *s);
-		string &insert(size_t pos, const char *s, size_t n);
-		string &insert(size_t pos, size_t n, char c);
+		basic_string &insert(size_t pos, const basic_string &str);
+		basic_string &insert(size_t pos, const basic_string &str, size_t subpos, size_t sublen = npos);
+		basic_string &insert(size_t pos, const CharT *s);
+		basic_string &insert(size_t pos, const CharT *s, size_t n);
+		basic_string &insert(size_t pos, size_t n, CharT c);
 
-		iterator insert(iterator p, size_t n, char c);
-		iterator insert(iterator p, char c);
+		iterator insert(iterator p, size_t n, CharT c);
+		iterator insert(iterator p, CharT c);
 
-		void push_back(char c) { insert(finish, c); }
+		// β׷ӵĿ·ÿռ㹻ʱֱд룬 insert İ߼
+		void push_back(CharT c)
+		{
+			if (finish != end_of_storage)
+				*finish++ = c;
+			else
+				append_aux(&c, 1);
+		}
 
 		template <typename InputIterator>
 		iterator insert(iterator p, InputIterator first, InputIterator last);
 
-		string &append(const string &str);
-		string &append(const string &str, size_t subpos, size_t sublen = npos);
-		string &append(const char *s);
-		string &append(const char *, size_t n);
-		string &append(size_t n, char c);
+		basic_string &append(const basic_string &str);
+		basic_string &append(const basic_string &str, size_t subpos, size_t sublen = npos);
+		basic_string &append(const CharT *s);
+		basic_string &append(const CharT *s, size_t n)
+		{
+			if (n <= static_cast<size_t>(end_of_storage - finish))
+			{
+				traits_type::copy(finish, s, n);
+				finish += n;
+			}
+			else
+				append_aux(s, n);
+			return *this;
+		}
+		basic_string &append(size_t n, CharT c);
+		basic_string &append(string_view_type sv) { return append(sv.data(), sv.size()); }
 
 		template <typename InputIterator>
-		string &append(InputIterator first, InputIterator last);
+		basic_string &append(InputIterator first, InputIterator last);
 
-		string &operator+=(const string &str);
-		string &operator+=(const char *s);
-		string &operator+=(char c);
+		basic_string &operator+=(const basic_string &str);
+		basic_string &operator+=(const CharT *s);
+		basic_string &operator+=(string_view_type sv) { return append(sv.data(), sv.size()); }
+		basic_string &operator+=(CharT c)
+		{
+			push_back(c);
+			return *this;
+		}
 
-		string &erase(size_t pos = 0, size_t len = npos);
+		basic_string &erase(size_t pos = 0, size_t len = npos);
 		void pop_back() { erase(finish - 1, finish); }
 		iterator erase(iterator p);
 		iterator erase(iterator first, iterator last);
 
-		string &replace(size_t pos, size_t len, const string &str);
-		string &replace(iterator i1, iterator i2, const string &str);
-		string &replace(size_t pos, size_t len, const string &str, size_t subpos, size_t sublen = npos);
-		string &replace(size_t pos, size_t len, const char *s);
-		string &replace(iterator i1, iterator i2, const char *s);
-		string &replace(size_t pos, size_t len, const char *s, size_t n);
-		string &replace(iterator i1, iterator i2, const char *s, size_t n);
-		string &replace(size_t pos, size_t len, size_t n, char c);
-		string &replace(iterator i1, iterator i2, size_t n, char c);
+		basic_string &replace(size_t pos, size_t len, const basic_string &str);
+		basic_string &replace(iterator i1, iterator i2, const basic_string &str);
+		basic_string &replace(size_t pos, size_t len, const basic_string &str, size_t subpos, size_t sublen = npos);
+		basic_string &replace(size_t pos, size_t len, const CharT *s);
+		basic_string &replace(iterator i1, iterator i2, const CharT *s);
+		basic_string &replace(size_t pos, size_t len, const CharT *s, size_t n);
+		basic_string &replace(iterator i1, iterator i2, const CharT *s, size_t n);
+		basic_string &replace(size_t pos, size_t len, size_t n, CharT c);
+		basic_string &replace(iterator i1, iterator i2, size_t n, CharT c);
 
 		template <typename InputIterator>
-		string &replace(iterator i1, iterator i2, InputIterator first, InputIterator last);
+		basic_string &replace(iterator i1, iterator i2, InputIterator first, InputIterator last);
 
-		void swap(string &str)
+		void swap(basic_string &str)
 		{
 			miniSTL::swap(start, str.start);
 			miniSTL::swap(finish, str.finish);
 			miniSTL::swap(end_of_storage, str.end_of_storage);
 		}
 
-		size_t copy(char *s,size_t len,size_t pos = 0) const
+		size_t copy(CharT *s,size_t len,size_t pos = 0) const
 		{
-			auto ptr = miniSTL::globals::uninitialized_copy(start + pos, start + pos + len, s);
-			return static_cast<size_t>(ptr - s);
+			traits_type::copy(s, start + pos, len);
+			return len;
 		}
 
-		size_t find(const string &str, size_t pos = 0) const;
-		size_t find(const char *s, size_t pos = 0) const;
-		size_t find(const char *s, size_t pos, size_t n) const;
-		size_t find(char c, size_t pos = 0) const;
-
-		size_t rfind(const string &str, size_t pos = npos) const;
-		size_t rfind(const char *s, size_t pos = npos) const;
-		size_t rfind(const char *s, size_t pos, size_t n) const;
-		size_t rfind(char c, size_t pos = npos) const;
-
-		size_t find_first_of(const string &str, size_t pos = 0) const;
-		size_t find_first_of(const char *s, size_t pos = 0) const;
-		size_t find_first_of(const char *s, size_t pos, size_t n) const;
-		size_t find_first_of(char c, size_t pos = 0) const;
-
-		size_t find_last_of(const string &str, size_t pos = npos) const;
-		size_t find_last_of(const char *s, size_t pos = npos) const;
-		size_t find_last_of(const char *s, size_t pos, size_t n) const;
-		size_t find_last_of(char c, size_t pos = npos) const;
-
-		size_t find_first_not_of(const string &str, size_t pos = 0) const;
-		size_t find_first_not_of(const char *s, size_t pos = 0) const;
-		size_t find_first_not_of(const char *s, size_t pos, size_t n) const;
-		size_t find_first_not_of(char c, size_t pos = 0) const;
-
-		size_t find_last_not_of(const string &str, size_t pos = npos) const;
-		size_t find_last_not_of(const char *s, size_t pos = npos) const;
-		size_t find_last_not_of(const char *s, size_t pos, size_t n) const;
-		size_t find_last_not_of(char c, size_t pos = npos) const;
-
-		string substr(size_t pos = 0, size_t len = npos) const
+		size_t find(const basic_string &str, size_t pos = 0) const;
+		size_t find(const CharT *s, size_t pos = 0) const;
+		size_t find(const CharT *s, size_t pos, size_t n) const;
+		size_t find(CharT c, size_t pos = 0) const;
+
+		size_t rfind(const basic_string &str, size_t pos = npos) const;
+		size_t rfind(const CharT *s, size_t pos = npos) const;
+		size_t rfind(const CharT *s, size_t pos, size_t n) const;
+		size_t rfind(CharT c, size_t pos = npos) const;
+
+		size_t find_first_of(const basic_string &str, size_t pos = 0) const;
+		size_t find_first_of(const CharT *s, size_t pos = 0) const;
+		size_t find_first_of(const CharT *s, size_t pos, size_t n) const;
+		size_t find_first_of(CharT c, size_t pos = 0) const;
+
+		size_t find_last_of(const basic_string &str, size_t pos = npos) const;
+		size_t find_last_of(const CharT *s, size_t pos = npos) const;
+		size_t find_last_of(const CharT *s, size_t pos, size_t n) const;
+		size_t find_last_of(CharT c, size_t pos = npos) const;
+
+		size_t find_first_not_of(const basic_string &str, size_t pos = 0) const;
+		size_t find_first_not_of(const CharT *s, size_t pos = 0) const;
+		size_t find_first_not_of(const CharT *s, size_t pos, size_t n) const;
+		size_t find_first_not_of(CharT c, size_t pos = 0) const;
+
+		size_t find_last_not_of(const basic_string &str, size_t pos = npos) const;
+		size_t find_last_not_of(const CharT *s, size_t pos = npos) const;
+		size_t find_last_not_of(const CharT *s, size_t pos, size_t n) const;
+		size_t find_last_not_of(CharT c, size_t pos = npos) const;
+
+		basic_string substr(size_t pos = 0, size_t len = npos) const
 		{
 			len = change_var_when_equal_npos(len, size(), pos);
-			return string(begin() + pos, begin() + pos + len);
+			return basic_string(start + pos, len);
 		}
 
-		int compare(const string &str) const;
-		int compare(size_t pos, size_t len, const string &str) const;
-		int compare(size_t pos, size_t len, const string &str,
+		int compare(const basic_string &str) const;
+		int compare(size_t pos, size_t len, const basic_string &str) const;
+		int compare(size_t pos, size_t len, const basic_string &str,
 			size_t subpos, size_t sublen = npos) const;
-		int compare(const char *s) const;
-		int compare(size_t pos, size_t len, const char *s) const;
-		int compare(size_t pos, size_t len, const char *s, size_t n) const;
+		int compare(const CharT *s) const;
+		int compare(size_t pos, size_t len, const CharT *s) const;
+		int compare(size_t pos, size_t len, const CharT *s, size_t n) const;
 
 	private:
-		void move_data(string &str);
+		void move_data(basic_string &str);
 		// ʱռ䲻
 		template <typename InputIterator>
 		iterator insert_aux_copy(iterator p, InputIterator first, InputIterator last);
@@ -214,59 +257,297 @@ namespace miniSTL
 		iterator insert_aux_fill_n(iterator p, size_t n, value_type c);
 		size_type get_new_capacity(size_type len) const;
 
-		void allocate_and_fill_n(size_t n, char c);
+		// β׷ʱռ䲻s ָ
+		void append_aux(const CharT *s, size_t n);
+		// ׷ʱμ֤ push_back/append ̯ O(1)
+		size_type get_append_capacity(size_type n) const;
+		static const size_t min_append_capacity = 16;
+
+		void allocate_and_fill_n(size_t n, CharT c);
 
 		template <typename InputIterator>
 		void allocate_and_copy(InputIterator first, InputIterator last);
 		
 		void destroy_and_deallocate();
 
-		size_t rfind_aux(const_iterator cit, size_t pos, size_t length_of_s, int cond) const;
-		size_t find_aux(const_iterator cit, size_t pos, size_t length_of_s, size_t cond) const;
 		int compare_aux(size_t pos, size_t len, const_iterator cit, size_t subpos, size_t sublen) const;
-		bool is_contained(char c, const_iterator first, const_iterator last) const;
+		//  [s, s+n) Ƿ c
+		static bool is_contained(CharT c, const CharT *s, size_t n)
+		{
+			return traits_type::find(s, n, c) != nullptr;
+		}
 		size_t change_var_when_equal_npos(size_t pos, size_t min_uend, size_t minue) const;
-
-	public:
-		friend std::ostream &operator <<(std::ostream &os, const string &str);
-		friend std::istream &operator>>(std::istream &is, string &str);
-		friend string operator+(const string &lhs, const string &rhs);
-		friend string operator+(const string &lhs, const char *rhs);
-		friend string operator+(const char *lhs, const string &rhs);
-		friend string operator+(const string &lhs, char rhs);
-		friend string operator+(char lhs, const string &rhs);
-
-		friend bool operator==(const string &lhs, const string &rhs);
-		friend bool operator==(const char *lhs, const string &rhs);
-		friend bool operator==(const string &lhs, const char *rhs);
-
-		friend bool operator!=(const string &lhs, const char *rhs);
-		friend bool operator!=(const char *lhs, const string &rhs);
-		friend bool operator!=(const string &lhs, const char *rhs);
-
-		friend bool operator<(const string &lhs, const string &rhs);
-		friend bool operator<(const char *lhs, const string &rhs);
-		friend bool operator<(const string &lhs, const char *rhs);
-
-		friend bool operator<=(const string &lhs, const string &rhs);
-		friend bool operator<=(const char *lhs, const string &rhs);
-		friend bool operator<=(const char *lhs, const string &rhs);
-
-		friend bool operator>(const string &lhs, const string &rhs);
-		friend bool operator>(const char *lhs, const string &rhs);
-		friend bool operator>(const string &lhs, const char *rhs);
-
-		friend bool operator>=(const string &lhs, const string &rhs);
-		friend bool operator>=(const char *lhs, const string &rhs);
-		friend bool operator>=(const string &lhs, const char *rhs);
-
-		friend void swap(string &x, string &y);
-		friend std::istream &getline(std::istream &is, string &str);
-		friend std::istream &getline(std::istream &is, string &str, char delim);
 	};// 
 
+	typedef basic_string<char>		string;
+	typedef basic_string<wchar_t>	wstring;
+	typedef basic_string<char16_t>	u16string;
+	typedef basic_string<char32_t>	u32string;
+
+	// ֻ string ṩʵּ mini_string.cpp
+	std::ostream &operator<<(std::ostream &os, const string &str);
+	std::istream &operator>>(std::istream &is, string &str);
+	std::istream &getline(std::istream &is, string &str);
+	std::istream &getline(std::istream &is, string &str, char delim);
+
+	template <typename CharT, typename Traits, typename Alloc>
+	struct hash<basic_string<CharT, Traits, Alloc>>
+	{
+		typedef basic_string<CharT, Traits, Alloc> argument_type;
+		typedef size_t result_type;
+		size_t operator()(const basic_string<CharT, Traits, Alloc> &str) const
+		{
+			return hash_bytes(str.data(), str.size() * sizeof(CharT));
+		}
+	};
+
+	namespace
+	{
+		// ҵһַϵַchar ʹ SIMD ʵ
+		template <typename CharT, typename Traits>
+		struct find_any_of_aux
+		{
+			static const CharT *apply(const CharT *first, const CharT *last, const CharT *s, size_t n)
+			{
+				for (;first != last;++first)
+				{
+					if (Traits::find(s, n, *first))
+						return first;
+				}
+				return last;
+			}
+		};
+
+		template <>
+		struct find_any_of_aux<char, char_traits<char>>
+		{
+			static const char *apply(const char *first, const char *last, const char *s, size_t n)
+			{
+				return simd::find_any_of(first, last, s, n);
+			}
+		};
+	}
+
+	template <typename CharT, typename Traits, typename Alloc>
+	const size_t basic_string<CharT, Traits, Alloc>::npos;
+
+	template <typename CharT, typename Traits, typename Alloc>
+	const size_t basic_string<CharT, Traits, Alloc>::min_append_capacity;
+
+	template <typename CharT, typename Traits, typename Alloc>
+	basic_string<CharT, Traits, Alloc>::basic_string(size_t n, CharT c)
+	{
+		allocate_and_fill_n(n, c);
+	}
+
+	template <typename CharT, typename Traits, typename Alloc>
+	basic_string<CharT, Traits, Alloc>::basic_string(const CharT *s)
+	{
+		allocate_and_copy(s, s + traits_type::length(s));
+	}
+
+	template <typename CharT, typename Traits, typename Alloc>
+	basic_string<CharT, Traits, Alloc>::basic_string(const CharT *s, size_t n)
+	{
+		allocate_and_copy(s, s + n);
+	}
+
+	template <typename CharT, typename Traits, typename Alloc>
+	basic_string<CharT, Traits, Alloc>::basic_string(string_view_type sv)
+	{
+		allocate_and_copy(sv.data(), sv.data() + sv.size());
+	}
+
+	template <typename CharT, typename Traits, typename Alloc>
+	basic_string<CharT, Traits, Alloc>::basic_string(const basic_string &str)
+	{
+		allocate_and_copy(str.start, str.finish);
+	}
+
+	template <typename CharT, typename Traits, typename Alloc>
+	basic_string<CharT, Traits, Alloc>::basic_string(basic_string &&str)
+	{
+		move_data(str);
+	}
+
+	template <typename CharT, typename Traits, typename Alloc>
+	basic_string<CharT, Traits, Alloc>::basic_string(const basic_string &str, size_t pos, size_t len)
+	{
+		len = change_var_when_equal_npos(len, str.size(), pos);
+		allocate_and_copy(str.start + pos, str.start + pos + len);
+	}
+
+	template <typename CharT, typename Traits, typename Alloc>
+	basic_string<CharT, Traits, Alloc>::~basic_string()
+	{
+		destroy_and_deallocate();
+	}
+
+	template <typename CharT, typename Traits, typename Alloc>
+	basic_string<CharT, Traits, Alloc> &basic_string<CharT, Traits, Alloc>::operator=(const basic_string &str)
+	{
+		if (this != &str)
+		{
+			destroy_and_deallocate();
+			allocate_and_copy(str.start, str.finish);
+		}
+		return *this;
+	}
+
+	template <typename CharT, typename Traits, typename Alloc>
+	basic_string<CharT, Traits, Alloc> &basic_string<CharT, Traits, Alloc>::operator=(basic_string &&str)
+	{
+		if (this != &str)
+		{
+			destroy_and_deallocate();
+			move_data(str);
+		}
+		return *this;
+	}
+
+	template <typename CharT, typename Traits, typename Alloc>
+	basic_string<CharT, Traits, Alloc> &basic_string<CharT, Traits, Alloc>::operator=(const CharT *s)
+	{
+		destroy_and_deallocate();
+		allocate_and_copy(s, s + traits_type::length(s));
+		return *this;
+	}
+
+	template <typename CharT, typename Traits, typename Alloc>
+	basic_string<CharT, Traits, Alloc> &basic_string<CharT, Traits, Alloc>::operator=(CharT c)
+	{
+		destroy_and_deallocate();
+		allocate_and_fill_n(1, c);
+		return *this;
+	}
+
+	template <typename CharT, typename Traits, typename Alloc>
+	void basic_string<CharT, Traits, Alloc>::resize(size_t n)
+	{
+		resize(n, value_type());
+	}
+
+	template <typename CharT, typename Traits, typename Alloc>
+	void basic_string<CharT, Traits, Alloc>::resize(size_t n, CharT c)
+	{
+		if (n < size())
+		{
+			data_allocator::destroy(start + n, finish);
+			finish = start + n;
+		}
+		else if (n > size() && n <= capacity())
+		{
+			auto length_of_insert = n - size();
+			finish = globals::uninitialized_fill_n(finish, length_of_insert, c);
+		}
+		else if (n > capacity())
+		{
+			auto length_of_insert = n - size();
+			auto new_capacity = get_new_capacity(length_of_insert);
+			iterator new_start = data_allocator::allocate(new_capacity);
+			iterator new_finish = miniSTL::globals::uninitialized_copy(begin(), end(), new_start);
+			new_finish = globals::uninitialized_fill_n(new_finish, length_of_insert, c);
+
+			destroy_and_deallocate();
+			start = new_start;
+			finish = new_finish;
+			end_of_storage = new_start + new_capacity;
+		}
+	}
+
+	template <typename CharT, typename Traits, typename Alloc>
+	void basic_string<CharT, Traits, Alloc>::reserve(size_t n)
+	{
+		if (n <= capacity())
+			return;
+
+		iterator new_start = data_allocator::allocate(n);
+		iterator new_finish = globals::uninitialized_copy(begin(), end(), new_start);
+		destroy_and_deallocate();
+		start = new_start;
+		finish = new_finish;
+		end_of_storage = start + n;
+	}
+
+	template <typename CharT, typename Traits, typename Alloc>
+	basic_string<CharT, Traits, Alloc> &basic_string<CharT, Traits, Alloc>::insert(size_t pos, const basic_string &str)
+	{
+		insert(start + pos, str.begin(), str.end());
+		return *this;
+	}
+
+	template <typename CharT, typename Traits, typename Alloc>
+	basic_string<CharT, Traits, Alloc> &basic_string<CharT, Traits, Alloc>::insert(size_t pos, const basic_string &str, size_t subpos, size_t sublen)
+	{
+		sublen = change_var_when_equal_npos(sublen, str.size(), subpos);
+		insert(begin() + pos, str.begin() + subpos, str.begin() + subpos + sublen);
+		return *this;
+	}
+
+	template <typename CharT, typename Traits, typename Alloc>
+	basic_string<CharT, Traits, Alloc> &basic_string<CharT, Traits, Alloc>::insert(size_t pos, const CharT *s)
+	{
+		insert(begin() + pos, s, s + traits_type::length(s));
+		return *this;
+	}
+
+	template <typename CharT, typename Traits, typename Alloc>
+	basic_string<CharT, Traits, Alloc> &basic_string<CharT, Traits, Alloc>::insert(size_t pos, const CharT *s, size_t n)
+	{
+		insert(begin() + pos, s, s + n);
+		return *this;
+	}
+
+	template <typename CharT, typename Traits, typename Alloc>
+	typename basic_string<CharT, Traits, Alloc>::iterator basic_string<CharT, Traits, Alloc>::insert_aux_fill_n(iterator p, size_t n, value_type c)
+	{
+		auto new_capacity = get_new_capacity(n);
+		iterator new_start = data_allocator::allocate(new_capacity);
+		iterator new_finish = globals::uninitialized_copy(start, p, new_start);
+		new_finish = globals::uninitialized_fill_n(new_finish, n, c);
+		auto res = new_finish;
+		new_finish = globals::uninitialized_copy(p, finish, new_finish);
+
+		destroy_and_deallocate();
+		start = new_start;
+		finish = new_finish;
+		end_of_storage = start + new_capacity;
+		return res;
+	}
+
+	template <typename CharT, typename Traits, typename Alloc>
+	basic_string<CharT, Traits, Alloc> &basic_string<CharT, Traits, Alloc>::insert(size_t pos, size_t n, CharT c)
+	{
+		insert(begin() + pos, n, c);
+		return *this;
+	}
+
+	template <typename CharT, typename Traits, typename Alloc>
+	typename basic_string<CharT, Traits, Alloc>::iterator basic_string<CharT, Traits, Alloc>::insert(iterator p, size_t n, CharT c)
+	{
+		auto length_of_left = capacity() - size();
+		if (n <= length_of_left)
+		{
+			traits_type::move(p + n, p, finish - p);
+			traits_type::assign(p, n, c);
+			finish += n;
+			return p + n;
+		}
+		else
+		{
+			return insert_aux_fill_n(p, n, c);
+		}
+	}
+
+	template <typename CharT, typename Traits, typename Alloc>
+	typename basic_string<CharT, Traits, Alloc>::iterator basic_string<CharT, Traits, Alloc>::insert(iterator p, CharT c)
+	{
+		return insert(p, 1, c);
+	}
+
+	template <typename CharT, typename Traits, typename Alloc>
 	template <typename InputIterator>
-	string::iterator string::insert_aux_copy(iterator p, InputIterator first, InputIterator last)
+	typename basic_string<CharT, Traits, Alloc>::iterator basic_string<CharT, Traits, Alloc>::insert_aux_copy(iterator p, InputIterator first, InputIterator last)
 	{
 		size_t length_of_insert = distance(first, last);
 		auto new_capacity = get_new_capacity(length_of_insert);
@@ -284,19 +565,16 @@ namespace miniSTL
 		return res;
 	}
 
+	template <typename CharT, typename Traits, typename Alloc>
 	template <typename InputIterator>
-	string::iterator string::insert(iterator p, InputIterator first, InputIterator last)
+	typename basic_string<CharT, Traits, Alloc>::iterator basic_string<CharT, Traits, Alloc>::insert(iterator p, InputIterator first, InputIterator last)
 	{
 		auto length_of_left = capacity() - size();
 		size_t length_of_insert = distance(first, last);
 		if (length_of_insert <= length_of_left)
 		{
-			// ʣռڲռ
-			for (iterator it = finish - 1;it >= p;--it)
-			{
-				*(it + length_of_insert) = *it;
-			}
-
+			// ʣռڲռ䣬ٿ
+			traits_type::move(p + length_of_insert, p, finish - p);
 			globals::uninitialized_copy(first, last, p);
 			finish += length_of_insert;
 			return p + length_of_insert;
@@ -308,29 +586,648 @@ namespace miniSTL
 		}
 	}
 
+	template <typename CharT, typename Traits, typename Alloc>
+	basic_string<CharT, Traits, Alloc> &basic_string<CharT, Traits, Alloc>::operator+=(const basic_string &str)
+	{
+		return append(str.start, str.size());
+	}
+
+	template <typename CharT, typename Traits, typename Alloc>
+	basic_string<CharT, Traits, Alloc> &basic_string<CharT, Traits, Alloc>::operator+=(const CharT *s)
+	{
+		return append(s, traits_type::length(s));
+	}
+
+	template <typename CharT, typename Traits, typename Alloc>
+	basic_string<CharT, Traits, Alloc> &basic_string<CharT, Traits, Alloc>::append(const basic_string &str)
+	{
+		return append(str.start, str.size());
+	}
+
+	template <typename CharT, typename Traits, typename Alloc>
+	basic_string<CharT, Traits, Alloc> &basic_string<CharT, Traits, Alloc>::append(const basic_string &str, size_t subpos, size_t sublen)
+	{
+		sublen = change_var_when_equal_npos(sublen, str.size(), subpos);
+		return append(str.start + subpos, sublen);
+	}
+
+	template <typename CharT, typename Traits, typename Alloc>
+	basic_string<CharT, Traits, Alloc> &basic_string<CharT, Traits, Alloc>::append(const CharT *s)
+	{
+		return append(s, traits_type::length(s));
+	}
+
+	template <typename CharT, typename Traits, typename Alloc>
+	basic_string<CharT, Traits, Alloc> &basic_string<CharT, Traits, Alloc>::append(size_t n, CharT c)
+	{
+		if (n > static_cast<size_t>(end_of_storage - finish))
+			reserve(get_append_capacity(n));
+		traits_type::assign(finish, n, c);
+		finish += n;
+		return *this;
+	}
+
+	template <typename CharT, typename Traits, typename Alloc>
 	template <typename InputIterator>
-	string &string::append(InputIterator first, InputIterator last)
+	basic_string<CharT, Traits, Alloc> &basic_string<CharT, Traits, Alloc>::append(InputIterator first, InputIterator last)
 	{
 		insert(end(), first, last);
 		return *this;
 	}
 
+	template <typename CharT, typename Traits, typename Alloc>
+	void basic_string<CharT, Traits, Alloc>::append_aux(const CharT *s, size_t n)
+	{
+		// ȰѾݺ s ¿ռ䣬ͷžɿռ䣬
+		//  s ָʱ str.append(str)Ҳǰȫ
+		auto new_capacity = get_append_capacity(n);
+		iterator new_start = data_allocator::allocate(new_capacity);
+		traits_type::copy(new_start, start, size());
+		iterator new_finish = new_start + size();
+		traits_type::copy(new_finish, s, n);
+		new_finish += n;
+
+		destroy_and_deallocate();
+		start = new_start;
+		finish = new_finish;
+		end_of_storage = start + new_capacity;
+	}
+
+	template <typename CharT, typename Traits, typename Alloc>
+	typename basic_string<CharT, Traits, Alloc>::iterator basic_string<CharT, Traits, Alloc>::erase(iterator first, iterator last)
+	{
+		size_t length_of_move = finish - last;
+		traits_type::move(first, last, length_of_move);
+		data_allocator::destroy(first + length_of_move, finish);
+		finish = first + length_of_move;
+		return first;
+	}
+
+	template <typename CharT, typename Traits, typename Alloc>
+	basic_string<CharT, Traits, Alloc> &basic_string<CharT, Traits, Alloc>::erase(size_t pos, size_t len)
+	{
+		len = change_var_when_equal_npos(len, size(), pos);
+		erase(begin() + pos, begin() + pos + len);
+		return *this;
+	}
+
+	template <typename CharT, typename Traits, typename Alloc>
+	typename basic_string<CharT, Traits, Alloc>::iterator basic_string<CharT, Traits, Alloc>::erase(iterator p)
+	{
+		return erase(p, p + 1);
+	}
+
+	template <typename CharT, typename Traits, typename Alloc>
+	basic_string<CharT, Traits, Alloc> &basic_string<CharT, Traits, Alloc>::replace(size_t pos, size_t len, const basic_string &str)
+	{
+		return replace(begin() + pos, begin() + pos + len, str.begin(), str.end());
+	}
+
+	template <typename CharT, typename Traits, typename Alloc>
+	basic_string<CharT, Traits, Alloc> &basic_string<CharT, Traits, Alloc>::replace(iterator i1, iterator i2, const basic_string &str)
+	{
+		return replace(i1, i2, str.begin(), str.end());
+	}
+
+	template <typename CharT, typename Traits, typename Alloc>
+	basic_string<CharT, Traits, Alloc> &basic_string<CharT, Traits, Alloc>::replace(size_t pos, size_t len, const basic_string &str, size_t subpos, size_t sublen)
+	{
+		sublen = change_var_when_equal_npos(sublen, str.size(), subpos);
+		return replace(begin() + pos, begin() + pos + len, str.begin() + subpos, str.begin() + subpos + sublen);
+	}
+
+	template <typename CharT, typename Traits, typename Alloc>
+	basic_string<CharT, Traits, Alloc> &basic_string<CharT, Traits, Alloc>::replace(size_t pos, size_t len, const CharT *s)
+	{
+		return replace(begin() + pos, begin() + pos + len, s, s + traits_type::length(s));
+	}
+
+	template <typename CharT, typename Traits, typename Alloc>
+	basic_string<CharT, Traits, Alloc> &basic_string<CharT, Traits, Alloc>::replace(iterator i1, iterator i2, const CharT *s)
+	{
+		return replace(i1, i2, s, s + traits_type::length(s));
+	}
+
+	template <typename CharT, typename Traits, typename Alloc>
+	basic_string<CharT, Traits, Alloc> &basic_string<CharT, Traits, Alloc>::replace(iterator i1, iterator i2, size_t n, CharT c)
+	{
+		auto ptr = erase(i1, i2);
+		insert(ptr, n, c);
+		return *this;
+	}
+
+	template <typename CharT, typename Traits, typename Alloc>
+	basic_string<CharT, Traits, Alloc> &basic_string<CharT, Traits, Alloc>::replace(size_t pos, size_t len, const CharT *s, size_t n)
+	{
+		return replace(begin() + pos, begin() + pos + len, s, s + n);
+	}
+
+	template <typename CharT, typename Traits, typename Alloc>
+	basic_string<CharT, Traits, Alloc> &basic_string<CharT, Traits, Alloc>::replace(iterator i1, iterator i2, const CharT *s, size_t n)
+	{
+		return replace(i1, i2, s, s + n);
+	}
+
+	template <typename CharT, typename Traits, typename Alloc>
+	basic_string<CharT, Traits, Alloc> &basic_string<CharT, Traits, Alloc>::replace(size_t pos, size_t len, size_t n, CharT c)
+	{
+		return replace(begin() + pos, begin() + pos + len, n, c);
+	}
+
+	template <typename CharT, typename Traits, typename Alloc>
 	template <typename InputIterator>
-	string &string::replace(iterator i1, iterator i2,
-		InputIterator first, InputIterator last)
+	basic_string<CharT, Traits, Alloc> &basic_string<CharT, Traits, Alloc>::replace(iterator i1, iterator i2, InputIterator first, InputIterator last)
 	{
 		auto ptr = erase(i1, i2);
 		insert(ptr, first, last);
 		return *this;
 	}
 
+	// ҽ string_view Traits::find λַٱȽʣಿ
+	template <typename CharT, typename Traits, typename Alloc>
+	size_t basic_string<CharT, Traits, Alloc>::find(const CharT *s, size_t pos, size_t n) const
+	{
+		return string_view_type(start, size()).find(string_view_type(s, n), pos);
+	}
+
+	template <typename CharT, typename Traits, typename Alloc>
+	size_t basic_string<CharT, Traits, Alloc>::find(const basic_string &str, size_t pos) const
+	{
+		return find(str.start, pos, str.size());
+	}
+
+	template <typename CharT, typename Traits, typename Alloc>
+	size_t basic_string<CharT, Traits, Alloc>::find(const CharT *s, size_t pos) const
+	{
+		return find(s, pos, traits_type::length(s));
+	}
+
+	template <typename CharT, typename Traits, typename Alloc>
+	size_t basic_string<CharT, Traits, Alloc>::find(CharT c, size_t pos) const
+	{
+		return string_view_type(start, size()).find(c, pos);
+	}
+
+	template <typename CharT, typename Traits, typename Alloc>
+	size_t basic_string<CharT, Traits, Alloc>::rfind(CharT c, size_t pos) const
+	{
+		if (empty())
+			return npos;
+		for (size_t i = miniSTL::min(pos, size() - 1);;--i)
+		{
+			if (traits_type::eq(start[i], c))
+				return i;
+			if (i == 0)
+				return npos;
+		}
+	}
+
+	template <typename CharT, typename Traits, typename Alloc>
+	size_t basic_string<CharT, Traits, Alloc>::rfind(const basic_string &str, size_t pos) const
+	{
+		return rfind(str.start, pos, str.size());
+	}
+
+	template <typename CharT, typename Traits, typename Alloc>
+	size_t basic_string<CharT, Traits, Alloc>::rfind(const CharT *s, size_t pos) const
+	{
+		return rfind(s, pos, traits_type::length(s));
+	}
+
+	template <typename CharT, typename Traits, typename Alloc>
+	size_t basic_string<CharT, Traits, Alloc>::rfind(const CharT *s, size_t pos, size_t n) const
+	{
+		if (n > size())
+			return npos;
+		for (size_t i = miniSTL::min(pos, size() - n);;--i)
+		{
+			if (traits_type::compare(start + i, s, n) == 0)
+				return i;
+			if (i == 0)
+				return npos;
+		}
+	}
+
+	template <typename CharT, typename Traits, typename Alloc>
+	int basic_string<CharT, Traits, Alloc>::compare(const basic_string &str) const
+	{
+		return compare(0, size(), str, 0, str.size());
+	}
+
+	template <typename CharT, typename Traits, typename Alloc>
+	int basic_string<CharT, Traits, Alloc>::compare(size_t pos, size_t len, const basic_string &str) const
+	{
+		return compare(pos, len, str, 0, str.size());
+	}
+
+	// Traits::compare  SIMD ҵһȵַٱȽϣchar  unsigned char memcmp һ£
+	template <typename CharT, typename Traits, typename Alloc>
+	int basic_string<CharT, Traits, Alloc>::compare_aux(size_t pos, size_t len, const_iterator cit,size_t subpos,size_t sublen) const
+	{
+		len = miniSTL::min(len, size() - pos);
+		size_t n = miniSTL::min(len, sublen);
+		int res = traits_type::compare(start + pos, cit + subpos, n);
+		if (res != 0)
+			return res < 0 ? -1 : 1;
+
+		if (len == sublen)
+			return 0;
+		else if (len < sublen)
+			return -1;
+		else
+			return 1;
+	}
+
+	template <typename CharT, typename Traits, typename Alloc>
+	int basic_string<CharT, Traits, Alloc>::compare(size_t pos, size_t len, const basic_string &str,size_t subpos,size_t sublen) const
+	{
+		sublen = miniSTL::min(sublen, str.size() - subpos);
+		return compare_aux(pos, len, str.begin(), subpos, sublen);
+	}
+
+	template <typename CharT, typename Traits, typename Alloc>
+	int basic_string<CharT, Traits, Alloc>::compare(const CharT *s) const
+	{
+		return compare(0, size(), s, traits_type::length(s));
+	}
+
+	template <typename CharT, typename Traits, typename Alloc>
+	int basic_string<CharT, Traits, Alloc>::compare(size_t pos, size_t len, const CharT *s) const
+	{
+		return compare(pos, len, s, traits_type::length(s));
+	}
+
+	template <typename CharT, typename Traits, typename Alloc>
+	int basic_string<CharT, Traits, Alloc>::compare(size_t pos, size_t len, const CharT *s, size_t n) const
+	{
+		return compare_aux(pos, len, s, 0, n);
+	}
+
+	template <typename CharT, typename Traits, typename Alloc>
+	size_t basic_string<CharT, Traits, Alloc>::find_first_of(const basic_string &str, size_t pos) const
+	{
+		return find_first_of(str.begin(), pos, str.size());
+	}
+
+	template <typename CharT, typename Traits, typename Alloc>
+	size_t basic_string<CharT, Traits, Alloc>::find_first_of(const CharT *s, size_t pos) const
+	{
+		return find_first_of(s, pos, traits_type::length(s));
+	}
+
+	template <typename CharT, typename Traits, typename Alloc>
+	size_t basic_string<CharT, Traits, Alloc>::find_first_of(const CharT *s, size_t pos, size_t n) const
+	{
+		if (pos >= size())
+			return npos;
+		auto cit = find_any_of_aux<CharT, Traits>::apply(start + pos, finish, s, n);
+		return cit == finish ? npos : static_cast<size_t>(cit - start);
+	}
+
+	template <typename CharT, typename Traits, typename Alloc>
+	size_t basic_string<CharT, Traits, Alloc>::find_first_of(CharT c, size_t pos) const
+	{
+		return find(c, pos);
+	}
+
+	template <typename CharT, typename Traits, typename Alloc>
+	size_t basic_string<CharT, Traits, Alloc>::find_first_not_of(const basic_string &str, size_t pos) const
+	{
+		return find_first_not_of(str.begin(), pos, str.size());
+	}
+
+	template <typename CharT, typename Traits, typename Alloc>
+	size_t basic_string<CharT, Traits, Alloc>::find_first_not_of(const CharT *s, size_t pos) const
+	{
+		return find_first_not_of(s, pos, traits_type::length(s));
+	}
+
+	template <typename CharT, typename Traits, typename Alloc>
+	size_t basic_string<CharT, Traits, Alloc>::find_first_not_of(const CharT *s, size_t pos, size_t n) const
+	{
+		for (size_t i = pos;i < size();++i)
+		{
+			if (!is_contained(start[i], s, n))
+				return i;
+		}
+		return npos;
+	}
+
+	template <typename CharT, typename Traits, typename Alloc>
+	size_t basic_string<CharT, Traits, Alloc>::find_first_not_of(CharT c, size_t pos) const
+	{
+		for (size_t i = pos;i < size();++i)
+		{
+			if (!traits_type::eq(start[i], c))
+				return i;
+		}
+		return npos;
+	}
+
+	template <typename CharT, typename Traits, typename Alloc>
+	size_t basic_string<CharT, Traits, Alloc>::find_last_of(const basic_string &str, size_t pos) const
+	{
+		return find_last_of(str.begin(), pos, str.size());
+	}
+
+	template <typename CharT, typename Traits, typename Alloc>
+	size_t basic_string<CharT, Traits, Alloc>::find_last_of(const CharT *s, size_t pos) const
+	{
+		return find_last_of(s, pos, traits_type::length(s));
+	}
+
+	template <typename CharT, typename Traits, typename Alloc>
+	size_t basic_string<CharT, Traits, Alloc>::find_last_of(const CharT *s, size_t pos, size_t n) const
+	{
+		if (empty())
+			return npos;
+		for (size_t i = miniSTL::min(pos, size() - 1);;--i)
+		{
+			if (is_contained(start[i], s, n))
+				return i;
+			if (i == 0)
+				return npos;
+		}
+	}
+
+	template <typename CharT, typename Traits, typename Alloc>
+	size_t basic_string<CharT, Traits, Alloc>::find_last_of(CharT c, size_t pos) const
+	{
+		return rfind(c, pos);
+	}
+
+	template <typename CharT, typename Traits, typename Alloc>
+	size_t basic_string<CharT, Traits, Alloc>::find_last_not_of(const basic_string &str, size_t pos) const
+	{
+		return find_last_not_of(str.begin(), pos, str.size());
+	}
+
+	template <typename CharT, typename Traits, typename Alloc>
+	size_t basic_string<CharT, Traits, Alloc>::find_last_not_of(const CharT *s, size_t pos) const
+	{
+		return find_last_not_of(s, pos, traits_type::length(s));
+	}
+
+	template <typename CharT, typename Traits, typename Alloc>
+	size_t basic_string<CharT, Traits, Alloc>::find_last_not_of(const CharT *s, size_t pos, size_t n) const
+	{
+		if (empty())
+			return npos;
+		for (size_t i = miniSTL::min(pos, size() - 1);;--i)
+		{
+			if (!is_contained(start[i], s, n))
+				return i;
+			if (i == 0)
+				return npos;
+		}
+	}
+
+	template <typename CharT, typename Traits, typename Alloc>
+	size_t basic_string<CharT, Traits, Alloc>::find_last_not_of(CharT c, size_t pos) const
+	{
+		if (empty())
+			return npos;
+		for (size_t i = miniSTL::min(pos, size() - 1);;--i)
+		{
+			if (!traits_type::eq(start[i], c))
+				return i;
+			if (i == 0)
+				return npos;
+		}
+	}
+
+	template <typename CharT, typename Traits, typename Alloc>
+	void basic_string<CharT, Traits, Alloc>::move_data(basic_string &str)
+	{
+		start = str.start;
+		finish = str.finish;
+		end_of_storage = str.end_of_storage;
+		str.start = str.finish = str.end_of_storage = nullptr;
+	}
+
+	template <typename CharT, typename Traits, typename Alloc>
+	typename basic_string<CharT, Traits, Alloc>::size_type basic_string<CharT, Traits, Alloc>::get_new_capacity(size_type len) const
+	{
+		size_type old_capacity = end_of_storage - start;
+		auto result = miniSTL::max(old_capacity, len);
+		auto new_capacity = old_capacity + result;
+
+		return new_capacity;
+	}
+
+	template <typename CharT, typename Traits, typename Alloc>
+	typename basic_string<CharT, Traits, Alloc>::size_type basic_string<CharT, Traits, Alloc>::get_append_capacity(size_type n) const
+	{
+		size_type required = size() + n;
+		size_type doubled = capacity() * 2;
+		return miniSTL::max(miniSTL::max(required, doubled), static_cast<size_type>(min_append_capacity));
+	}
+
+	template <typename CharT, typename Traits, typename Alloc>
+	void basic_string<CharT, Traits, Alloc>::allocate_and_fill_n(size_t n, CharT c)
+	{
+		start = data_allocator::allocate(n);
+		finish = globals::uninitialized_fill_n(start, n, c);
+		end_of_storage = start + n;
+	}
+
+	template <typename CharT, typename Traits, typename Alloc>
 	template <typename InputIterator>
-	void string::allocate_and_copy(InputIterator first, InputIterator last)
+	void basic_string<CharT, Traits, Alloc>::allocate_and_copy(InputIterator first, InputIterator last)
 	{
 		start = data_allocator::allocate(last - first);
 		finish = globals::uninitialized_copy(first, last, start);
 		end_of_storage = finish;
 	}
+
+	template <typename CharT, typename Traits, typename Alloc>
+	void basic_string<CharT, Traits, Alloc>::destroy_and_deallocate()
+	{
+		data_allocator::destroy(start, finish);
+		data_allocator::deallocate(start, end_of_storage - start);
+		
+		start = finish = end_of_storage = nullptr;
+	}
+
+	template <typename CharT, typename Traits, typename Alloc>
+	size_t basic_string<CharT, Traits, Alloc>::change_var_when_equal_npos(size_t var, size_t minuend, size_t minue) const
+	{
+		return var == npos ? (minuend - minue) : var;
+	}
+
+	// Ȱһ reserve׷ӣֻһڴ
+	template <typename CharT, typename Traits, typename Alloc>
+	basic_string<CharT, Traits, Alloc> operator+(const basic_string<CharT, Traits, Alloc> &lhs, const basic_string<CharT, Traits, Alloc> &rhs)
+	{
+		basic_string<CharT, Traits, Alloc> res;
+		res.reserve(lhs.size() + rhs.size());
+		res.append(lhs.data(), lhs.size());
+		res.append(rhs.data(), rhs.size());
+		return res;
+	}
+
+	template <typename CharT, typename Traits, typename Alloc>
+	basic_string<CharT, Traits, Alloc> operator+(const basic_string<CharT, Traits, Alloc> &lhs, const CharT *rhs)
+	{
+		size_t length_of_rhs = Traits::length(rhs);
+		basic_string<CharT, Traits, Alloc> res;
+		res.reserve(lhs.size() + length_of_rhs);
+		res.append(lhs.data(), lhs.size());
+		res.append(rhs, length_of_rhs);
+		return res;
+	}
+
+	template <typename CharT, typename Traits, typename Alloc>
+	basic_string<CharT, Traits, Alloc> operator+(const CharT *lhs, const basic_string<CharT, Traits, Alloc> &rhs)
+	{
+		size_t length_of_lhs = Traits::length(lhs);
+		basic_string<CharT, Traits, Alloc> res;
+		res.reserve(length_of_lhs + rhs.size());
+		res.append(lhs, length_of_lhs);
+		res.append(rhs.data(), rhs.size());
+		return res;
+	}
+
+	template <typename CharT, typename Traits, typename Alloc>
+	basic_string<CharT, Traits, Alloc> operator+(const basic_string<CharT, Traits, Alloc> &lhs, CharT rhs)
+	{
+		basic_string<CharT, Traits, Alloc> res;
+		res.reserve(lhs.size() + 1);
+		res.append(lhs.data(), lhs.size());
+		res.push_back(rhs);
+		return res;
+	}
+
+	template <typename CharT, typename Traits, typename Alloc>
+	basic_string<CharT, Traits, Alloc> operator+(CharT lhs, const basic_string<CharT, Traits, Alloc> &rhs)
+	{
+		basic_string<CharT, Traits, Alloc> res;
+		res.reserve(1 + rhs.size());
+		res.push_back(lhs);
+		res.append(rhs.data(), rhs.size());
+		return res;
+	}
+
+	// Ȳͬʱֱӷأͬʱ Traits::compare Ƚ
+	template <typename CharT, typename Traits, typename Alloc>
+	bool operator==(const basic_string<CharT, Traits, Alloc> &lhs, const basic_string<CharT, Traits, Alloc> &rhs)
+	{
+		return lhs.size() == rhs.size() && Traits::compare(lhs.data(), rhs.data(), lhs.size()) == 0;
+	}
+
+	template <typename CharT, typename Traits, typename Alloc>
+	bool operator==(const CharT *lhs, const basic_string<CharT, Traits, Alloc> &rhs)
+	{
+		return rhs == lhs;
+	}
+
+	template <typename CharT, typename Traits, typename Alloc>
+	bool operator==(const basic_string<CharT, Traits, Alloc> &lhs, const CharT *rhs)
+	{
+		size_t len = Traits::length(rhs);
+		return lhs.size() == len && Traits::compare(lhs.data(), rhs, len) == 0;
+	}
+
+	template <typename CharT, typename Traits, typename Alloc>
+	bool operator!=(const basic_string<CharT, Traits, Alloc> &lhs, const basic_string<CharT, Traits, Alloc> &rhs)
+	{
+		return !(lhs == rhs);
+	}
+
+	template <typename CharT, typename Traits, typename Alloc>
+	bool operator!=(const CharT *lhs, const basic_string<CharT, Traits, Alloc> &rhs)
+	{
+		return !(lhs == rhs);
+	}
+
+	template <typename CharT, typename Traits, typename Alloc>
+	bool operator!=(const basic_string<CharT, Traits, Alloc> &lhs, const CharT *rhs)
+	{
+		return !(lhs == rhs);
+	}
+
+	// ¹ϵ compare()
+	template <typename CharT, typename Traits, typename Alloc>
+	bool operator<(const basic_string<CharT, Traits, Alloc> &lhs, const basic_string<CharT, Traits, Alloc> &rhs)
+	{
+		return lhs.compare(rhs) < 0;
+	}
+
+	template <typename CharT, typename Traits, typename Alloc>
+	bool operator<(const CharT *lhs, const basic_string<CharT, Traits, Alloc> &rhs)
+	{
+		return rhs.compare(lhs) > 0;
+	}
+
+	template <typename CharT, typename Traits, typename Alloc>
+	bool operator<(const basic_string<CharT, Traits, Alloc> &lhs, const CharT *rhs)
+	{
+		return lhs.compare(rhs) < 0;
+	}
+
+	template <typename CharT, typename Traits, typename Alloc>
+	bool operator<=(const basic_string<CharT, Traits, Alloc> &lhs, const basic_string<CharT, Traits, Alloc> &rhs)
+	{
+		return lhs.compare(rhs) <= 0;
+	}
+
+	template <typename CharT, typename Traits, typename Alloc>
+	bool operator<=(const CharT *lhs, const basic_string<CharT, Traits, Alloc> &rhs)
+	{
+		return rhs.compare(lhs) >= 0;
+	}
+
+	template <typename CharT, typename Traits, typename Alloc>
+	bool operator<=(const basic_string<CharT, Traits, Alloc> &lhs, const CharT *rhs)
+	{
+		return lhs.compare(rhs) <= 0;
+	}
+
+	template <typename CharT, typename Traits, typename Alloc>
+	bool operator>(const basic_string<CharT, Traits, Alloc> &lhs, const basic_string<CharT, Traits, Alloc> &rhs)
+	{
+		return lhs.compare(rhs) > 0;
+	}
+
+	template <typename CharT, typename Traits, typename Alloc>
+	bool operator>(const CharT *lhs, const basic_string<CharT, Traits, Alloc> &rhs)
+	{
+		return rhs.compare(lhs) < 0;
+	}
+
+	template <typename CharT, typename Traits, typename Alloc>
+	bool operator>(const basic_string<CharT, Traits, Alloc> &lhs, const CharT *rhs)
+	{
+		return lhs.compare(rhs) > 0;
+	}
+
+	template <typename CharT, typename Traits, typename Alloc>
+	bool operator>=(const basic_string<CharT, Traits, Alloc> &lhs, const basic_string<CharT, Traits, Alloc> &rhs)
+	{
+		return lhs.compare(rhs) >= 0;
+	}
+
+	template <typename CharT, typename Traits, typename Alloc>
+	bool operator>=(const CharT *lhs, const basic_string<CharT, Traits, Alloc> &rhs)
+	{
+		return rhs.compare(lhs) <= 0;
+	}
+
+	template <typename CharT, typename Traits, typename Alloc>
+	bool operator>=(const basic_string<CharT, Traits, Alloc> &lhs, const CharT *rhs)
+	{
+		return lhs.compare(rhs) >= 0;
+	}
+
+	template <typename CharT, typename Traits, typename Alloc>
+	void swap(basic_string<CharT, Traits, Alloc> &x, basic_string<CharT, Traits, Alloc> &y)
+	{
+		x.swap(y);
+	}
+
+
+	// string  mini_string.cpp ʽʵ
+	extern template class basic_string<char>;
 }
 
 #endif
@@ -0,0 +1,158 @@
+/*
+* ļʵ ַפ string_pool
+*/
+#include "mini_string_pool.h"
+
+#include <new>
+
+namespace miniSTL
+{
+	const string_pool::id_type string_pool::npos;
+
+	string_pool::string_pool()
+		:count(0), slot_count(64), blocks(nullptr), arena_cur(nullptr), arena_end(nullptr)
+	{
+		pages = page_allocator::allocate(MAX_PAGES);
+		memset(pages, 0, sizeof(entry*) * MAX_PAGES);
+		slots = slot_allocator::allocate(slot_count);
+		memset(slots, 0, sizeof(id_type) * slot_count);
+	}
+
+	string_pool::~string_pool()
+	{
+		for (size_t i = 0;i != MAX_PAGES && pages[i];++i)
+			entry_allocator::deallocate(pages[i], PAGE_SIZE);
+		page_allocator::deallocate(pages, MAX_PAGES);
+		slot_allocator::deallocate(slots, slot_count);
+
+		while (blocks)
+		{
+			block *next = blocks->next;
+			char_allocator::deallocate(reinterpret_cast<char*>(blocks), sizeof(block) + blocks->size);
+			blocks = next;
+		}
+	}
+
+	size_t string_pool::size() const
+	{
+		std::shared_lock<std::shared_timed_mutex> lock(mutex);
+		return count;
+	}
+
+	string_pool::id_type string_pool::find(string_view s) const
+	{
+		size_t h = hash_bytes(s.data(), s.size());
+		std::shared_lock<std::shared_timed_mutex> lock(mutex);
+		return lookup(s, h);
+	}
+
+	string_pool::id_type string_pool::intern(string_view s)
+	{
+		size_t h = hash_bytes(s.data(), s.size());
+		{
+			// ַڶ²
+			std::shared_lock<std::shared_timed_mutex> lock(mutex);
+			id_type id = lookup(s, h);
+			if (id != npos)
+				return id;
+		}
+		std::unique_lock<std::shared_timed_mutex> lock(mutex);
+		// ͷŶ߳̿ѲͬһַҪ²
+		id_type id = lookup(s, h);
+		if (id != npos)
+			return id;
+		return insert(s, h);
+	}
+
+	string_pool::id_type string_pool::lookup(string_view s, size_t h) const
+	{
+		size_t mask = slot_count - 1;
+		for (size_t i = h & mask;;i = (i + 1) & mask)
+		{
+			id_type slot = slots[i];
+			if (slot == 0)
+				return npos;
+			const entry &e = get_entry(slot - 1);
+			// ȱȽϻɢֵͳȣƥĲ۲ַ
+			if (e.hash == h && e.len == s.size() &&
+				(s.size() == 0 || memcmp(e.ptr, s.data(), s.size()) == 0))
+				return slot - 1;
+		}
+	}
+
+	string_pool::id_type string_pool::insert(string_view s, size_t h)
+	{
+		if (count == static_cast<size_t>(MAX_PAGES) * PAGE_SIZE)
+			throw std::bad_alloc();
+
+		id_type id = static_cast<id_type>(count);
+		entry *&page = pages[id >> PAGE_SHIFT];
+		if (page == nullptr)
+			page = entry_allocator::allocate(PAGE_SIZE);
+
+		entry &e = page[id & (PAGE_SIZE - 1)];
+		e.ptr = store(s);
+		e.len = s.size();
+		e.hash = h;
+		++count;
+
+		// ӱ 1/2 
+		if (count * 2 > slot_count)
+			rehash(slot_count * 2);
+		else
+		{
+			size_t mask = slot_count - 1;
+			size_t i = h & mask;
+			while (slots[i] != 0)
+				i = (i + 1) & mask;
+			slots[i] = id + 1;
+		}
+		return id;
+	}
+
+	void string_pool::rehash(size_t new_slot_count)
+	{
+		id_type *new_slots = slot_allocator::allocate(new_slot_count);
+		memset(new_slots, 0, sizeof(id_type) * new_slot_count);
+		size_t mask = new_slot_count - 1;
+		for (size_t id = 0;id != count;++id)
+		{
+			size_t i = get_entry(static_cast<id_type>(id)).hash & mask;
+			while (new_slots[i] != 0)
+				i = (i + 1) & mask;
+			new_slots[i] = static_cast<id_type>(id + 1);
+		}
+		slot_allocator::deallocate(slots, slot_count);
+		slots = new_slots;
+		slot_count = new_slot_count;
+	}
+
+	const char *string_pool::store(string_view s)
+	{
+		size_t n = s.size() + 1;
+		if (static_cast<size_t>(arena_end - arena_cur) < n)
+		{
+			// ַռһ飬˷ѵǰʣռ
+			size_t block_size = n > BLOCK_SIZE / 4 ? n : static_cast<size_t>(BLOCK_SIZE);
+			char *raw = char_allocator::allocate(sizeof(block) + block_size);
+			block *b = reinterpret_cast<block*>(raw);
+			b->size = block_size;
+			b->next = blocks;
+			blocks = b;
+			if (block_size == n)
+			{
+				memcpy(raw + sizeof(block), s.data(), s.size());
+				raw[sizeof(block) + s.size()] = '\0';
+				return raw + sizeof(block);
+			}
+			arena_cur = raw + sizeof(block);
+			arena_end = arena_cur + block_size;
+		}
+		char *result = arena_cur;
+		if (s.size() != 0)
+			memcpy(result, s.data(), s.size());
+		result[s.size()] = '\0';
+		arena_cur += n;
+		return result;
+	}
+}
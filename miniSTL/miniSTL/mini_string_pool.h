@@ -0,0 +1,102 @@
+#ifndef _STRING_POOL_H
+#define _STRING_POOL_H
+
+#include "mini_allocator.h"
+#include "mini_hash.h"
+#include "mini_string_view.h"
+
+#include <cstdint>
+#include <mutex>
+#include <shared_mutex>
+
+namespace miniSTL
+{
+	/*
+	* ַפ (interning)
+	* ͬݵַֻһݣֻڴ (arena) У
+	*  32 λ id ʾid ȵҽȣȽΪ O(1)
+	* ֱΪ map/set/unordered_set ļ
+	* ÿַɢֵפʱһβ
+	* פַڳǰַ䣬view() ص string_view һֱЧ
+	*
+	* ̰߳ȫintern()/find() ɲãҹռд
+	* view()/hash()  id ȡid ֻѾص intern()/find()
+	*/
+	class string_pool final
+	{
+	public:
+		typedef uint32_t id_type;
+		static const id_type npos = static_cast<id_type>(-1);
+
+	private:
+		struct entry
+		{
+			const char *ptr;
+			size_t hash;
+			size_t len; //  string_view ĳͬ4 GiB ϵַᱻض
+		};
+
+		// ڴͷַݽ
+		struct block
+		{
+			block *next;
+			size_t size;
+		};
+
+		enum _EPAGE { PAGE_SHIFT = 12, PAGE_SIZE = 1 << PAGE_SHIFT }; // ÿҳ entry 
+		enum _EMAXPAGES { MAX_PAGES = 1 << 14 }; // ҳС 2^26 ַ
+		enum _EBLOCKSIZE { BLOCK_SIZE = 64 * 1024 }; // arena ÿĴС
+
+		typedef miniSTL::allocator<char>		char_allocator;
+		typedef miniSTL::allocator<entry>		entry_allocator;
+		typedef miniSTL::allocator<entry*>		page_allocator;
+		typedef miniSTL::allocator<id_type>		slot_allocator;
+
+		entry **pages; // ҳһͲƶȡʱ
+		size_t count; // פַ
+		id_type *slots; // Ŷַɢб id + 10 ʾղ
+		size_t slot_count; //  2 
+
+		block *blocks;
+		char *arena_cur;
+		char *arena_end;
+
+		mutable std::shared_timed_mutex mutex;
+
+	public:
+		string_pool();
+		string_pool(const string_pool &) = delete;
+		string_pool &operator=(const string_pool &) = delete;
+		~string_pool();
+
+		//  s Ӧ idʱȰ s 
+		id_type intern(string_view s);
+		// ֻҲ룬ʱ npos
+		id_type find(string_view s) const;
+
+		string_view view(id_type id) const
+		{
+			const entry &e = get_entry(id);
+			return string_view(e.ptr, e.len);
+		}
+
+		size_t hash(id_type id) const { return get_entry(id).hash; }
+		// פַ '\0' β
+		const char *c_str(id_type id) const { return get_entry(id).ptr; }
+		size_t size() const;
+
+	private:
+		const entry &get_entry(id_type id) const
+		{
+			return pages[id >> PAGE_SHIFT][id & (PAGE_SIZE - 1)];
+		}
+
+		// ɢбвңҵ id  npos
+		id_type lookup(string_view s, size_t h) const;
+		id_type insert(string_view s, size_t h);
+		void rehash(size_t new_slot_count);
+		const char *store(string_view s);
+	};
+}
+
+#endif
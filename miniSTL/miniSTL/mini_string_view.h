@@ -0,0 +1,131 @@
+#ifndef _STRING_VIEW_H
+#define _STRING_VIEW_H
+
+#include "mini_char_traits.h"
+#include "mini_reverse_iterator.h"
+
+#include <cstddef>
+
+namespace miniSTL
+{
+	/*
+	* basic_string_view ֻһָͳȣӵַָ
+	* ڲݵ basic_string еһַ
+	* ʹ豣֤ basic_string_view ڵײЧ
+	*/
+	template <typename CharT, typename Traits = char_traits<CharT>>
+	class basic_string_view final
+	{
+	public:
+		typedef Traits								traits_type;
+		typedef CharT								value_type;
+		typedef const CharT*						iterator;
+		typedef const CharT*						const_iterator;
+		typedef reverse_iterator_t<const CharT*>	const_reverse_iterator;
+		typedef const value_type&					const_reference;
+		typedef size_t								size_type;
+		typedef ptrdiff_t							difference_type;
+		static const size_t npos = -1;
+
+	private:
+		const CharT *ptr;
+		size_t len;
+
+	public:
+		basic_string_view() :ptr(nullptr), len(0) {}
+		basic_string_view(const CharT *s) :ptr(s), len(traits_type::length(s)) {}
+		basic_string_view(const CharT *s, size_t n) :ptr(s), len(n) {}
+
+		const_iterator begin() const { return ptr; }
+		const_iterator end() const { return ptr + len; }
+		const_iterator cbegin() const { return ptr; }
+		const_iterator cend() const { return ptr + len; }
+		const_reverse_iterator crbegin() const { return const_reverse_iterator(ptr + len); }
+		const_reverse_iterator crend() const { return const_reverse_iterator(ptr); }
+
+		size_t size() const { return len; }
+		size_t length() const { return len; }
+		bool empty() const { return len == 0; }
+		const CharT *data() const { return ptr; }
+
+		const CharT &operator[](size_t pos) const { return ptr[pos]; }
+		const CharT &front() const { return *ptr; }
+		const CharT &back() const { return ptr[len - 1]; }
+
+		void remove_prefix(size_t n) { ptr += n; len -= n; }
+		void remove_suffix(size_t n) { len -= n; }
+
+		basic_string_view substr(size_t pos = 0, size_t n = npos) const
+		{
+			if (n == npos || n > len - pos)
+				n = len - pos;
+			return basic_string_view(ptr + pos, n);
+		}
+
+		size_t find(CharT c, size_t pos = 0) const
+		{
+			if (pos >= len)
+				return npos;
+			auto p = traits_type::find(ptr + pos, len - pos, c);
+			return p ? static_cast<size_t>(p - ptr) : npos;
+		}
+
+		size_t find(basic_string_view sv, size_t pos = 0) const
+		{
+			if (sv.len == 0)
+				return pos <= len ? pos : npos;
+			// ȶλַٱȽʣಿ
+			while (pos < len && len - pos >= sv.len)
+			{
+				pos = find(sv.ptr[0], pos);
+				if (pos == npos || len - pos < sv.len)
+					return npos;
+				if (traits_type::compare(ptr + pos, sv.ptr, sv.len) == 0)
+					return pos;
+				++pos;
+			}
+			return npos;
+		}
+
+		int compare(basic_string_view sv) const
+		{
+			size_t n = len < sv.len ? len : sv.len;
+			int res = traits_type::compare(ptr, sv.ptr, n);
+			if (res != 0)
+				return res < 0 ? -1 : 1;
+			return len == sv.len ? 0 : (len < sv.len ? -1 : 1);
+		}
+
+		bool starts_with(basic_string_view sv) const
+		{
+			return len >= sv.len && traits_type::compare(ptr, sv.ptr, sv.len) == 0;
+		}
+
+		bool ends_with(basic_string_view sv) const
+		{
+			return len >= sv.len && traits_type::compare(ptr + len - sv.len, sv.ptr, sv.len) == 0;
+		}
+
+	public:
+		friend bool operator==(basic_string_view lhs, basic_string_view rhs)
+		{
+			return lhs.len == rhs.len && traits_type::compare(lhs.ptr, rhs.ptr, lhs.len) == 0;
+		}
+
+		friend bool operator!=(basic_string_view lhs, basic_string_view rhs) { return !(lhs == rhs); }
+		friend bool operator<(basic_string_view lhs, basic_string_view rhs) { return lhs.compare(rhs) < 0; }
+		friend bool operator<=(basic_string_view lhs, basic_string_view rhs) { return lhs.compare(rhs) <= 0; }
+		friend bool operator>(basic_string_view lhs, basic_string_view rhs) { return lhs.compare(rhs) > 0; }
+		friend bool operator>=(basic_string_view lhs, basic_string_view rhs) { return lhs.compare(rhs) >= 0; }
+	};
+
+	template <typename CharT, typename Traits>
+	const size_t basic_string_view<CharT, Traits>::npos;
+
+	typedef basic_string_view<char>		string_view;
+	typedef basic_string_view<wchar_t>	wstring_view;
+	typedef basic_string_view<char16_t>	u16string_view;
+	typedef basic_string_view<char32_t>	u32string_view;
+}
+
+#endif
@@ -0,0 +1,262 @@
+/*
+* ļʵ thread_pool  task_group
+*/
+#include "mini_thread_pool.h"
+#include "mini_simd.h"
+
+#include <cstdint>
+
+namespace miniSTL
+{
+	namespace
+	{
+		enum
+		{
+			IDLE_SPIN_ROUNDS = 8, // Ҳʱÿֵĵȴʱӱ
+			IDLE_YIELD_ROUNDS = 16, // ֮óʱƬ֮
+			INJECT_COMPACT_THRESHOLD = 1024 // ȡߵĲֳôʱѹ
+		};
+
+		// ȴʱʾ CPU ͹ģóˮ߸ͬһϵһ߳
+		inline void cpu_relax()
+		{
+#ifdef MINI_HAS_SSE2
+			_mm_pause();
+#else
+			std::this_thread::yield();
+#endif
+		}
+
+		// xorshift ѡȡĶ󣬱п߳Ǽͬһ߳
+		inline unsigned next_random(unsigned &state)
+		{
+			state ^= state << 13;
+			state ^= state >> 17;
+			state ^= state << 5;
+			return state;
+		}
+
+		thread_local unsigned external_random = 0;
+	}
+
+	struct thread_pool::worker
+	{
+		thread_pool *pool;
+		work_stealing_deque<task_type*> tasks;
+		std::thread thread;
+		unsigned random;
+
+		worker(thread_pool *p, unsigned seed) :pool(p), random(seed) {}
+	};
+
+	thread_local thread_pool::worker *thread_pool::current = nullptr;
+
+	thread_pool::thread_pool(size_t threads)
+		:inject_head(0), inject_count(0), epoch(0), sleepers(0), stopping(false)
+	{
+		if (threads == 0)
+		{
+			size_t hw = std::thread::hardware_concurrency();
+			threads = hw > 1 ? hw - 1 : 0;
+		}
+		workers.reserve(threads);
+		// Ƚж̣߳߳ȡʱ workers
+		for (size_t i = 0;i != threads;++i)
+			workers.push_back(new worker(this, static_cast<unsigned>(2 * i + 1) * 0x9E3779B9u));
+		for (size_t i = 0;i != threads;++i)
+		{
+			worker *w = workers[i];
+			w->thread = std::thread([this, w]() { worker_loop(w); });
+		}
+	}
+
+	thread_pool::~thread_pool()
+	{
+		stopping.store(true, std::memory_order_seq_cst);
+		{
+			std::lock_guard<std::mutex> lock(sleep_mtx);
+			sleep_cv.notify_all();
+		}
+		for (size_t i = 0;i != workers.size();++i)
+			workers[i]->thread.join();
+		// ǰύҪִ꣬ûй߳ʱִ
+		while (task_type *task = find_task(nullptr))
+			execute(task);
+		for (size_t i = 0;i != workers.size();++i)
+			delete workers[i];
+	}
+
+	void thread_pool::submit(task_type task)
+	{
+		// ûй̣߳˻ϵĬ̳߳أʱŽоûִˣֱڵִ߳
+		if (workers.empty())
+		{
+			task();
+			return;
+		}
+		task_type *p = allocator<task_type>::allocate(1);
+		new(p) task_type(std::move(task));
+		worker *self = current;
+		if (self && self->pool == this)
+		{
+			self->tasks.push(p);
+		}
+		else
+		{
+			std::lock_guard<std::mutex> lock(inject_mtx);
+			injected.push_back(p);
+			inject_count.fetch_add(1, std::memory_order_release);
+		}
+		notify_work();
+	}
+
+	bool thread_pool::run_pending_task()
+	{
+		worker *self = current;
+		task_type *task = find_task(self && self->pool == this ? self : nullptr);
+		if (!task)
+			return false;
+		execute(task);
+		return true;
+	}
+
+	/*
+	* γԣԼĶССѡĹ߳̿ʼȡ
+	* self Ϊձʾ߲Ǳ̳߳صĹ߳
+	*/
+	thread_pool::task_type *thread_pool::find_task(worker *self)
+	{
+		task_type *task = nullptr;
+		if (self && self->tasks.pop(task))
+			return task;
+
+		if (inject_count.load(std::memory_order_acquire) != 0)
+		{
+			std::lock_guard<std::mutex> lock(inject_mtx);
+			if (inject_head != injected.size())
+			{
+				task = injected[inject_head++];
+				inject_count.fetch_sub(1, std::memory_order_relaxed);
+				if (inject_head == injected.size())
+				{
+					injected.clear();
+					inject_head = 0;
+				}
+				else if (inject_head >= INJECT_COMPACT_THRESHOLD && 2 * inject_head >= injected.size())
+				{
+					injected.erase(injected.begin(), injected.begin() + inject_head);
+					inject_head = 0;
+				}
+				return task;
+			}
+		}
+
+		const size_t n = workers.size();
+		if (n == 0)
+			return nullptr;
+		unsigned &random = self ? self->random : external_random;
+		if (random == 0)
+			random = static_cast<unsigned>(reinterpret_cast<uintptr_t>(&random)) | 1u;
+		size_t start = next_random(random) % n;
+		for (size_t k = 0;k != n;++k)
+		{
+			worker *victim = workers[(start + k) % n];
+			if (victim != self && victim->tasks.steal(task))
+				return task;
+		}
+		return nullptr;
+	}
+
+	void thread_pool::execute(task_type *task)
+	{
+		(*task)();
+		task->~task_type();
+		allocator<task_type>::deallocate(task, 1);
+	}
+
+	/*
+	* ʱһߵĹ߳
+	* ߳ sleep_mtx µǼΪߡټ epoch epoch ټߣ
+	* ߶ seq_cst Ҫô￴߲Ҫô epoch ѱ仯
+	*/
+	void thread_pool::notify_work()
+	{
+		epoch.fetch_add(1, std::memory_order_seq_cst);
+		if (sleepers.load(std::memory_order_seq_cst) != 0)
+		{
+			std::lock_guard<std::mutex> lock(sleep_mtx);
+			sleep_cv.notify_one();
+		}
+	}
+
+	void thread_pool::worker_loop(worker *self)
+	{
+		current = self;
+		unsigned idle_rounds = 0;
+		for (;;)
+		{
+			// ڲ֮ǰȡ epochڼύʹ epoch 仯
+			unsigned long long seen = epoch.load(std::memory_order_seq_cst);
+			task_type *task = find_task(self);
+			if (task)
+			{
+				execute(task);
+				idle_rounds = 0;
+				continue;
+			}
+			if (stopping.load(std::memory_order_seq_cst))
+				break;
+
+			// ָ˱ܣóʱƬֱ
+			if (idle_rounds < IDLE_SPIN_ROUNDS)
+			{
+				for (unsigned i = 0;i != (1u << idle_rounds);++i)
+					cpu_relax();
+				++idle_rounds;
+				continue;
+			}
+			if (idle_rounds < IDLE_SPIN_ROUNDS + IDLE_YIELD_ROUNDS)
+			{
+				std::this_thread::yield();
+				++idle_rounds;
+				continue;
+			}
+			std::unique_lock<std::mutex> lock(sleep_mtx);
+			sleepers.fetch_add(1, std::memory_order_seq_cst);
+			while (epoch.load(std::memory_order_seq_cst) == seen && !stopping.load(std::memory_order_seq_cst))
+				sleep_cv.wait(lock);
+			sleepers.fetch_sub(1, std::memory_order_seq_cst);
+			idle_rounds = 0;
+		}
+		current = nullptr;
+	}
+
+	thread_pool &thread_pool::default_pool()
+	{
+		static thread_pool pool;
+		return pool;
+	}
+
+	void task_group::wait()
+	{
+		unsigned idle_rounds = 0;
+		while (pending.load(std::memory_order_acquire) != 0)
+		{
+			// ûпִе˵ʣµִ߳УԵƬٿ
+			if (pool.run_pending_task())
+			{
+				idle_rounds = 0;
+			}
+			else if (idle_rounds < IDLE_SPIN_ROUNDS)
+			{
+				for (unsigned i = 0;i != (1u << idle_rounds);++i)
+					cpu_relax();
+				++idle_rounds;
+			}
+			else
+			{
+				std::this_thread::yield();
+			}
+		}
+	}
+}
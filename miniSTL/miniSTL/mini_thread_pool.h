@@ -0,0 +1,298 @@
+#ifndef _THREAD_POOL_H
+#define _THREAD_POOL_H
+
+#include "mini_allocator.h"
+#include "mini_vector.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <new>
+#include <thread>
+
+namespace miniSTL
+{
+	/*
+	* Chase-Lev ȡ˫˶УԪΪָȿƽƵ
+	* ֻ߳̿ڵײ push / popȳ̴߳Ӷ stealȽȳ
+	* ʱ߰ѻһȡ߿ڶ飬ԾҪʱͷ
+	* top  bottom ϵĲʹ seq_cst ڴȡһԪʱȡ߿ CAS top ʤ
+	*/
+	template <typename T>
+	class work_stealing_deque final
+	{
+	private:
+		struct ring
+		{
+			ptrdiff_t mask; // һΪ 2 
+			std::atomic<T> *slots;
+
+			T get(ptrdiff_t i) const { return slots[i & mask].load(std::memory_order_relaxed); }
+			void put(ptrdiff_t i, T x) { slots[i & mask].store(x, std::memory_order_relaxed); }
+		};
+
+		std::atomic<ptrdiff_t> top;
+		std::atomic<ptrdiff_t> bottom;
+		std::atomic<ring*> array;
+		vector<ring*> retired; // ֻ߷
+
+	public:
+		explicit work_stealing_deque(size_t capacity = 64) :top(0), bottom(0)
+		{
+			size_t cap = 2;
+			while (cap < capacity)
+				cap *= 2;
+			array.store(new_ring(static_cast<ptrdiff_t>(cap)), std::memory_order_relaxed);
+		}
+
+		~work_stealing_deque()
+		{
+			delete_ring(array.load(std::memory_order_relaxed));
+			for (size_t i = 0;i != retired.size();++i)
+				delete_ring(retired[i]);
+		}
+
+		work_stealing_deque(const work_stealing_deque&) = delete;
+		work_stealing_deque &operator=(const work_stealing_deque&) = delete;
+
+		// ֻߵ
+		void push(T x)
+		{
+			ptrdiff_t b = bottom.load(std::memory_order_relaxed);
+			ptrdiff_t t = top.load(std::memory_order_seq_cst);
+			ring *a = array.load(std::memory_order_relaxed);
+			if (b - t > a->mask)
+				a = grow(a, t, b);
+			a->put(b, x);
+			bottom.store(b + 1, std::memory_order_seq_cst);
+		}
+
+		// ֻߵãΪʱ false
+		bool pop(T &x)
+		{
+			ptrdiff_t b = bottom.load(std::memory_order_relaxed) - 1;
+			ring *a = array.load(std::memory_order_relaxed);
+			bottom.store(b, std::memory_order_seq_cst);
+			ptrdiff_t t = top.load(std::memory_order_seq_cst);
+			if (t > b)
+			{
+				// Ϊ
+				bottom.store(b + 1, std::memory_order_relaxed);
+				return false;
+			}
+			x = a->get(b);
+			if (t == b)
+			{
+				// ֻʣһԪأȡ߾
+				bool won = top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+				bottom.store(b + 1, std::memory_order_relaxed);
+				return won;
+			}
+			return true;
+		}
+
+		// κ̶߳ԵãΪջ߳̾ʧʱ false
+		bool steal(T &x)
+		{
+			ptrdiff_t t = top.load(std::memory_order_seq_cst);
+			ptrdiff_t b = bottom.load(std::memory_order_seq_cst);
+			if (t >= b)
+				return false;
+			ring *a = array.load(std::memory_order_acquire);
+			x = a->get(t);
+			return top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+		}
+
+		// ֵ߳ͬʱʱο
+		bool empty() const
+		{
+			return bottom.load(std::memory_order_relaxed) <= top.load(std::memory_order_relaxed);
+		}
+
+	private:
+		static ring *new_ring(ptrdiff_t capacity)
+		{
+			ring *r = allocator<ring>::allocate(1);
+			r->mask = capacity - 1;
+			r->slots = allocator<std::atomic<T>>::allocate(capacity);
+			for (ptrdiff_t i = 0;i != capacity;++i)
+				new(r->slots + i) std::atomic<T>();
+			return r;
+		}
+
+		static void delete_ring(ring *r)
+		{
+			allocator<std::atomic<T>>::deallocate(r->slots, r->mask + 1);
+			allocator<ring>::deallocate(r, 1);
+		}
+
+		ring *grow(ring *a, ptrdiff_t t, ptrdiff_t b)
+		{
+			ring *bigger = new_ring(2 * (a->mask + 1));
+			for (ptrdiff_t i = t;i != b;++i)
+				bigger->put(i, a->get(i));
+			retired.push_back(a);
+			array.store(bigger, std::memory_order_release);
+			return bigger;
+		}
+	};
+
+	/*
+	* ȡ̳߳أ㷨ʹãҲֱύû
+	* ÿ߳һ work_stealing_deque
+	*   ߳ύŽԼĶУԼӵײȡȳѺã
+	*   е̴̶߳߳еĶȡȽȳͨһ鹤
+	*   ǹ߳ύŽһĹ
+	* ҲĹ߳óʱƬߣύʱ
+	* ȴɵ̲߳յȣȡִУ
+	* ڲύ񲢵ȴΪ̺߳ľ
+	* Ӧ׳쳣
+	*/
+	class thread_pool
+	{
+	public:
+		typedef std::function<void()> task_type;
+
+	private:
+		struct worker;
+
+		vector<worker*> workers;
+
+		// ǹ߳ύ[inject_head, injected.size()) ΪδȡߵĲ
+		std::mutex inject_mtx;
+		vector<task_type*> injected;
+		size_t inject_head;
+		std::atomic<size_t> inject_count;
+
+		// еĹ߳ sleep_cv ߣÿύ epoch һ
+		std::mutex sleep_mtx;
+		std::condition_variable sleep_cv;
+		std::atomic<unsigned long long> epoch;
+		std::atomic<size_t> sleepers;
+		std::atomic<bool> stopping;
+
+		static thread_local worker *current;
+
+	public:
+		// threads Ϊ߳0 ʾӲ߳һ߱ҲִУ
+		// ûй߳ʱ submit ֱڵִ߳
+		explicit thread_pool(size_t threads = 0);
+		~thread_pool();
+
+		thread_pool(const thread_pool&) = delete;
+		thread_pool &operator=(const thread_pool&) = delete;
+
+		// ͬʱִ߳ȴеĵ
+		size_t concurrency() const { return workers.size() + 1; }
+
+		void submit(task_type task);
+
+		// ڵǰִ߳һŶеȡԼеģûпִеʱ false
+		bool run_pending_task();
+
+		// ڹ̳߳أһʹʱ
+		static thread_pool &default_pool();
+
+	private:
+		task_type *find_task(worker *self);
+		static void execute(task_type *task);
+		void notify_work();
+		void worker_loop(worker *self);
+	};
+
+	/*
+	* һصrun() ύspawnwait() ȴȫɣsync
+	* пԼͬһ task_group ύ
+	* ʱԶȴ
+	*/
+	class task_group
+	{
+	private:
+		thread_pool &pool;
+		std::atomic<size_t> pending;
+
+	public:
+		explicit task_group(thread_pool &p = thread_pool::default_pool()) :pool(p), pending(0) {}
+		~task_group() { wait(); }
+
+		task_group(const task_group&) = delete;
+		task_group &operator=(const task_group&) = delete;
+
+		template <typename Function>
+		void run(Function f)
+		{
+			pending.fetch_add(1, std::memory_order_relaxed);
+			pool.submit([this, f]() mutable
+			{
+				f();
+				pending.fetch_sub(1, std::memory_order_release);
+			});
+		}
+
+		void wait();
+
+		thread_pool &get_pool() const { return pool; }
+	};
+
+	/*
+	* fork-joinf ڵǰִ߳Уg Ϊύʱ߶
+	*/
+	template <typename F,typename G>
+	void parallel_invoke(F f, G g, thread_pool &pool = thread_pool::default_pool())
+	{
+		task_group group(pool);
+		group.run(g);
+		f();
+		group.wait();
+	}
+
+	namespace
+	{
+		template <typename Index,typename Body>
+		void parallel_for_split(task_group &group, Index lo, Index hi, Index grain, const Body *body)
+		{
+			// Ұ벿ΪŽ̵߳ĶУ벿ּ
+			while (hi - lo > grain)
+			{
+				Index mid = lo + (hi - lo) / 2;
+				group.run([&group, mid, hi, grain, body]() { parallel_for_split(group, mid, hi, grain, body); });
+				hi = mid;
+			}
+			(*body)(lo, hi);
+		}
+	}
+
+	/*
+	* parallel_for
+	*  [first,last) ݹֱ֣Ȳ grainÿ body(lo, hi)
+	* ȲǽϴĿ飬ڶж߳ȡ
+	* grain Ϊ 0 ʱԶѡʹÿ߳ƽֵԼ 8 
+	* body ڶ߳ͬʱãͨ const õ
+	*/
+	template <typename Index,typename Body>
+	void parallel_for(Index first, Index last, Index grain, const Body &body,
+		thread_pool &pool = thread_pool::default_pool())
+	{
+		if (!(first < last))
+			return;
+		if (grain == 0)
+		{
+			grain = static_cast<Index>((last - first) / (8 * pool.concurrency()));
+			if (grain == 0)
+				grain = 1;
+		}
+		task_group group(pool);
+		parallel_for_split(group, first, last, grain, &body);
+		group.wait();
+	}
+
+	template <typename Index,typename Body>
+	void parallel_for(Index first, Index last, const Body &body)
+	{
+		parallel_for(first, last, Index(0), body);
+	}
+}
+
+#endif
@@ -2,6 +2,8 @@
 #ifndef _TYPE_TRAITS_H
 #define _TYPE_TRAITS_H
 
+#include <type_traits>
+
 namespace miniSTL
 {
 	/*
@@ -33,268 +35,46 @@ namespace miniSTL
 			using result = T2;
 		};
 
-		struct _true_type
-		{
-			bool operator() { return true; }
-		};
-		struct _false_type {}
-		{
-			bool operator() { return false; }
-		}
+		struct _true_type {};
+		struct _false_type {};
 
 	/*
 	* ȡ͵
-	* صֵ _false_type
+	* ɱڽԣ <type_traits> ¶Ƶ
+	* ֮⣬Աƽ͵ûṹ塢pair<int,int> ҲЧʵ·
+	* 븳ֵҪͿƽƣtrivially copyable memmove 
+	* ҪȻΪضػ _type_traits
 	*/
 	template <typename T>
 	struct _type_traits
 	{
-		typedef _false_type    has_trivial_default_constructor;
-		typedef _false_type    has_trivial_copy_constructor;
-		typedef _false_type	   has_trivial_assignment_operator;
-		typedef _false_type    has_trivial_destructor;
-		typedef _false_type    is_POD_type;
-	};
-
-	// һЩͽػ
-	template <>
-	struct _type_traits<bool>
-	{
-		typedef _true_type		has_trivial_default_constructor;
-		typedef _true_type		has_trivial_copy_constructor;
-		typedef _true_type		has_trivial_assignment_operator;
-		typedef _true_type		has_trivial_destructor;
-		typedef _true_type		is_POD_type;
-	};
-
-	template<>
-	struct _type_traits<char>
-	{
-		typedef _true_type		has_trivial_default_constructor;
-		typedef _true_type		has_trivial_copy_constructor;
-		typedef _true_type		has_trivial_assignment_operator;
-		typedef _true_type		has_trivial_destructor;
-		typedef _true_type		is_POD_type;
-	};
-
-	template <>
-	struct _type_traits<unsigned char>
-	{
-		typedef _true_type		has_trivial_default_constructor;
-		typedef _true_type		has_trivial_copy_constructor;
-		typedef	_true_type		has_trivial_assignment_operator;
-		typedef _true_type		has_trivial_destructor;
-		typedef _true_type		is_POD_type;
-	};
-
-	template <>
-	struct _type_traits<signed char>
-	{
-		typedef _true_type		has_trivial_default_constructor;
-		typedef	_true_type		has_trivial_copy_constructor;
-		typedef _true_type		has_trivial_assignment_operator;
-		typedef _true_type		has_trivial_destructor;
-		typedef _true_type		is_POD_type;
-	};
-
-	template <>
-	struct _type_traits<wchar_t>
-	{
-		typedef _true_type		has_trivial_default_constructor;
-		typedef _true_type		has_trivial_copy_constructor;
-		typedef _true_type		has_trivial_assignment_operator;
-		typedef _true_type		has_trivial_destructor;
-		typedef _true_type		is_POD_type;
-	};
-
-	template <>
-	struct _type_traits<short>
-	{
-		typedef _true_type		has_trivial_default_constructor;
-		typedef _true_type		has_trivial_copy_constructor;
-		typedef _true_type		has_trivial_assignment_operator;
-		typedef _true_type		has_trivial_destructor;
-		typedef _true_type		is_POD_type;
-	};
-
-	template <>
-	struct _type_traits<unsigned short>
-	{
-		typedef _true_type		has_trivial_default_constructor;
-		typedef _true_type		has_trivial_copy_constructor;
-		typedef _true_type		has_trivial_assignment_operator;
-		typedef _true_type		has_trivial_destructor;
-		typedef	_true_type		is_POD_type;
-	};
+	private:
+		static const bool trivially_copyable = std::is_trivially_copyable<T>::value;
 
-	template <>
-	struct _type_traits<int>
-	{
-		typedef _true_type		has_trivial_default_constructor;
-		typedef	_true_type		has_trivial_copy_construtor;
-		typedef _true_type		has_trivial_assignment_operator;
-		typedef _true_type		has_trivial_destructor;
-		typedef _true_type		is_POD_type;
-	};
-
-	template <>
-	struct _type_traits<unsigned int>
-	{
-		typedef _true_type		has_trivial_default_constructor;
-		typedef _true_type		has_trivial_copy_constructor;
-		typedef _true_type		has_trivial_assignment_operator;
-		typedef _true_type		has_trivial_destructor;
-		typedef	_true_type		is_POD_type;
-	};
-
-	template <>
-	struct _type_traits<long>
-	{
-		typedef _true_type		has_trivial_default_constructor;
-		typedef _true_type		has_trivial_copy_constructor;
-		typedef _true_type		has_trivial_assignment_operator;
-		typedef _true_type		has_trivial_destructor;
-		typedef	_true_type		is_POD_type;
-	};
-
-	template <>
-	struct _type_traits<unsigned long>
-	{
-		typedef _true_type		has_trivial_default_constructor;
-		typedef _true_type		has_trivial_copy_constructor;
-		typedef _true_type		has_trivial_assignment_operator;
-		typedef _true_type		has_trivial_destructor;
-		typedef	_true_type		is_POD_type;
-	};
-
-	template <>
-	struct _type_traits<long long>
-	{
-		typedef _true_type		has_trivial_default_constructor;
-		typedef _true_type		has_trivial_copy_constructor;
-		typedef _true_type		has_trivial_assignment_operator;
-		typedef _true_type		has_trivial_destructor;
-		typedef	_true_type		is_POD_type;
-	};
-
-	template <>
-	struct _type_traits<unsigned long long>
-	{
-		typedef _true_type		has_trivial_default_constructor;
-		typedef _true_type		has_trivial_copy_constructor;
-		typedef _true_type		has_trivial_assignment_operator;
-		typedef _true_type		has_trivial_destructor;
-		typedef	_true_type		is_POD_type;
-	};
-
-	template <>
-	struct _type_traits<float>
-	{
-		typedef _true_type		has_trivial_default_constructor;
-		typedef _true_type		has_trivial_copy_constructor;
-		typedef _true_type		has_trivial_assignment_operator;
-		typedef _true_type		has_trivial_destructor;
-		typedef	_true_type		is_POD_type;
-	};
-
-	template <>
-	struct _type_traits<double>
-	{
-		typedef _true_type		has_trivial_default_constructor;
-		typedef _true_type		has_trivial_copy_constructor;
-		typedef _true_type		has_trivial_assignment_operator;
-		typedef _true_type		has_trivial_destructor;
-		typedef	_true_type		is_POD_type;
-	};
-
-	template <>
-	struct _type_traits<long double>
-	{
-		typedef _true_type		has_trivial_default_constructor;
-		typedef _true_type		has_trivial_copy_constructor;
-		typedef _true_type		has_trivial_assignment_operator;
-		typedef _true_type		has_trivial_destructor;
-		typedef	_true_type		is_POD_type;
-	};
-
-	template <typename T>
-	struct  _type_traits<T*>
-	{
-		typedef _true_type		has_trivial_default_constructor;
-		typedef _true_type		has_trivial_copy_constructor;
-		typedef _true_type		has_trivial_assignment_operator;
-		typedef _true_type		has_trivial_destructor;
-		typedef	_true_type		is_POD_type;
+	public:
+		typedef typename FirstOrSecond<std::is_trivially_default_constructible<T>::value,
+			_true_type, _false_type>::result has_trivial_default_constructor;
+		typedef typename FirstOrSecond<trivially_copyable && std::is_trivially_copy_constructible<T>::value,
+			_true_type, _false_type>::result has_trivial_copy_constructor;
+		typedef typename FirstOrSecond<trivially_copyable && std::is_trivially_copy_assignable<T>::value,
+			_true_type, _false_type>::result has_trivial_assignment_operator;
+		typedef typename FirstOrSecond<std::is_trivially_destructible<T>::value,
+			_true_type, _false_type>::result has_trivial_destructor;
+		typedef typename FirstOrSecond<std::is_pod<T>::value,
+			_true_type, _false_type>::result is_POD_type;
 	};
 
+	/*
+	* ֽȼȼ operator== ȵͣö١ָ
+	* Щ͵ memcmp  SIMD ֽڱȽ
+	* ڴУNaN != NaN+0.0 == -0.0
+	*/
 	template <typename T>
-	struct _type_traits<const T*>
-	{
-		typedef _true_type		has_trivial_default_constructor;
-		typedef _true_type		has_trivial_copy_constructor;
-		typedef _true_type		has_trivial_assignment_operator;
-		typedef _true_type		has_trivial_destructor;
-		typedef	_true_type		is_POD_type;
-	};
-
-	template<>
-	struct _type_traits<char*>
-	{
-		typedef _true_type		has_trivial_default_constructor;
-		typedef _true_type		has_trivial_copy_constructor;
-		typedef _true_type		has_trivial_assignment_operator;
-		typedef _true_type		has_trivial_destructor;
-		typedef	_true_type		is_POD_type;
-	};
-
-	template <>
-	struct _type_traits<unsigned char*>
-	{
-		typedef _true_type		has_trivial_default_constructor;
-		typedef _true_type		has_trivial_copy_constructor;
-		typedef _true_type		has_trivial_assignment_operator;
-		typedef _true_type		has_trivial_destructor;
-		typedef	_true_type		is_POD_type;
-	};
-
-	template <>
-	struct _type_traits<signed char*>
-	{
-		typedef _true_type		has_trivial_default_constructor;
-		typedef _true_type		has_trivial_copy_constructor;
-		typedef _true_type		has_trivial_assignment_operator;
-		typedef _true_type		has_trivial_destructor;
-		typedef	_true_type		is_POD_type;
-	};
-
-	template <>
-	struct _type_traits<const char*>
-	{
-		typedef _true_type		has_trivial_default_constructor;
-		typedef _true_type		has_trivial_copy_constructor;
-		typedef _true_type		has_trivial_assignment_operator;
-		typedef _true_type		has_trivial_destructor;
-		typedef	_true_type		is_POD_type;
-	};
-
-	template <>
-	struct _type_traits<const unsigned char*>
-	{
-		typedef _true_type		has_trivial_default_constructor;
-		typedef _true_type		has_trivial_copy_constructor;
-		typedef _true_type		has_trivial_assignment_operator;
-		typedef _true_type		has_trivial_destructor;
-		typedef	_true_type		is_POD_type;
-	};
-
-	template <>
-	struct _type_traits<const signed char*>
+	struct _is_bitwise_comparable
 	{
-		typedef _true_type		has_trivial_default_constructor;
-		typedef _true_type		has_trivial_copy_constructor;
-		typedef _true_type		has_trivial_assignment_operator;
-		typedef _true_type		has_trivial_destructor;
-		typedef	_true_type		is_POD_type;
+		static const bool value = std::is_integral<T>::value || std::is_enum<T>::value ||
+			std::is_pointer<T>::value;
+		typedef typename FirstOrSecond<value, _true_type, _false_type>::result type;
 	};
 }
 
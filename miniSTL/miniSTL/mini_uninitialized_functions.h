@@ -9,7 +9,23 @@
 namespace miniSTL
 {
 
-	
+	/*
+	* ĿԪؿƽƹ졢ƽֵ T ԪͬʱΪ _true_type
+	* ʱδʼĿռϸƹȼֽڸƣԽ copy / fill
+	* ǽһԭָʹ memmove / memset
+	* copy / fill ϻ˻ΪֵԻҪֵƽģ
+	*  const óԱͿƽƹ죬ȴûпõĸֵ
+	*/
+	template <typename ForwardIterator,typename T>
+	struct _is_trivially_constructible_from
+	{
+		typedef typename iterator_traits<ForwardIterator>::value_type value_type;
+		static const bool value = std::is_same<typename std::remove_cv<T>::type, value_type>::value &&
+			std::is_same<typename _type_traits<value_type>::has_trivial_copy_constructor, _true_type>::value &&
+			std::is_same<typename _type_traits<value_type>::has_trivial_assignment_operator, _true_type>::value;
+		typedef typename FirstOrSecond<value, _true_type, _false_type>::result type;
+	};
+
 	/*
 	* ʵȫֺռglobals
 	* uninitialized_copy()
@@ -54,27 +70,9 @@ namespace miniSTL
 		template <typename InputIterator,typename ForwardIterator>
 		ForwardIterator uninitialized_copy(InputIterator first, InputIterator last, ForwardIterator result)
 		{
-			typedef typename _type_traits<typename iterator_traits<InputIterator>::value_type>::is_POD_type is_pod;
-			return _uninitialized_copy_aux(first, last, result, is_pod());
-		}
-
-		/*
-		*  char*  wchar_t* ͣԲЧʵ memmove
-		*/
-		template <>
-		inline char *uninitialized_copy(const char *first, const char *last,
-			char *result)
-		{
-			memmove(result, first, last - first);
-			return result + (last - first);
-		}
-
-		template <>
-		inline wchar_t *uninitialized_copy(const wchar_t *first, const wchar_t *last,
-			wchar_t *result)
-		{
-			memmove(result, first, sizeof(wchar_t) * (last - first));
-			return result + (last - first);
+			typedef typename _is_trivially_constructible_from<ForwardIterator,
+				typename iterator_traits<InputIterator>::value_type>::type is_trivial;
+			return _uninitialized_copy_aux(first, last, result, is_trivial());
 		}
 
 		/*
@@ -89,8 +87,8 @@ namespace miniSTL
 		template <typename ForwardIterator,typename T>
 		inline void uninitialized_fill(ForwardIterator first, ForwardIterator last, const T &value)
 		{
-			typedef typename _type_traits<T>::is_POD_Type is_pod;
-			_uninitialized_fill_aux(first, last, value, is_pod());
+			typedef typename _is_trivially_constructible_from<ForwardIterator, T>::type is_trivial;
+			_uninitialized_fill_aux(first, last, value, is_trivial());
 		}
 		
 		/*
@@ -103,8 +101,8 @@ namespace miniSTL
 		inline ForwardIterator uninitialized_fill_n(ForwardIterator first,
 			Size n, const T &value)
 		{
-			typedef typename _type_traits<T>::is_POD_type is_pod;
-			return _uninitialized_fill_n_aux(first, n, value, is_pod());
+			typedef typename _is_trivially_constructible_from<ForwardIterator, T>::type is_trivial;
+			return _uninitialized_fill_n_aux(first, n, value, is_trivial());
 		}
 	}
 
@@ -114,11 +112,11 @@ namespace miniSTL
 		ForwardIterator _uninitialized_copy_aux(InputIterator first, InputIterator last,
 			ForwardIterator result, _true_type)
 		{
-			// PODͣɲЧߵĸַ
-			return copy(first, last, result);
+			// ƽƹ죬ɲЧߵĸַ
+			return miniSTL::copy(first, last, result);
 		}
 
-		//  POD 
+		// Ҫøƹ캯
 		template <typename InputIterator, typename ForwardIterator>
 		ForwardIterator _uninitialized_copy_aux(InputIterator first, InputIterator last,
 			ForwardIterator result, _false_type)
@@ -132,40 +130,40 @@ namespace miniSTL
 			return cur;
 		}
 
-		//  POD 
+		// ƽƹ죬 fillԭָϻᾡʹ memset
 		template <typename ForwardIterator, typename T>
 		inline void _uninitialized_fill_aux(ForwardIterator first, ForwardIterator last,
 			const T &value, _true_type)
 		{
-			fill(first, last, value);
+			miniSTL::fill(first, last, value);
 		}
 
-		//  POD 
+		// Ҫøƹ캯
 		template <typename ForwardIterator, typename T>
 		void _uninitialized_fill_aux(ForwardIterator first, ForwardIterator last,
 			const T &value, _false_type)
 		{
-
 			for (auto cur = first;cur != last;++cur)
 			{
-				construct(&*first, value);
+				construct(&*cur, value);
 			}
 		}
 
-		//  POD 
+		// ƽƹ죬 fill_n
 		template <typename ForwardIterator, typename Size, typename T>
 		ForwardIterator _uninitialized_fill_n_aux(ForwardIterator first, Size n,
 			const T &value, _true_type)
 		{
-			return fill_n(first, n, value);
+			return miniSTL::fill_n(first, n, value);
 		}
 
-		//  POD 
+		// Ҫøƹ캯
 		template <typename ForwardIterator, typename Size, typename T>
 		ForwardIterator _uninitialized_fill_n_aux(ForwardIterator first, Size n,
 			const T &value, _false_type)
 		{
-			for (auto cur = first;n > 0;--n, ++cur)
+			auto cur = first;
+			for (;n > 0;--n, ++cur)
 			{
 				construct(&*cur, value);
 			}
@@ -4,6 +4,7 @@
 #include "mini_allocator.h"
 #include "mini_algorithm.h"
 #include "mini_functional.h"
+#include "mini_hash.h"
 #include "mini_iterator.h"
 #include "mini_list.h"
 #include "mini_vector.h"
@@ -17,7 +18,7 @@ namespace miniSTL
 
 	namespace
 	{
-		template <typename Key, typename ListIterator, typename Hash = std::hash<Key>,
+		template <typename Key, typename ListIterator, typename Hash = miniSTL::hash<Key>,
 			typename KeyEqual = miniSTL::equal_to<Key>, typename Allocator = miniSTL::allocator < Key >>
 		class ust_iterator :public iterator<forward_iterator_tag, Key>
 		{
@@ -48,7 +49,7 @@ namespace miniSTL
 		};
 	}
 
-	template <typename Key, typename Hash = std::hash<Key>,
+	template <typename Key, typename Hash = miniSTL::hash<Key>,
 		typename KeyEqual = miniSTL::equal_to<Key>, typename Allocator = miniSTL::allocator < Key >>
 	class unordered_set final
 	{
@@ -0,0 +1,451 @@
+/*
+* ļʵ UTF-8 У顢ת
+*/
+#include "mini_utf8.h"
+#include "mini_simd.h"
+
+namespace miniSTL
+{
+	namespace utf8
+	{
+		namespace
+		{
+			typedef const unsigned char *byte_ptr;
+
+			/*
+			*  p һַֽ*p >= 0x80һַλãǷʱ nullptr
+			* ڶֽڵȡֵΧֽڱ仯Դų롢ͳ U+10FFFF 
+			*/
+			inline byte_ptr decode(byte_ptr p, byte_ptr last, char32_t &cp)
+			{
+				const unsigned b0 = p[0];
+				if (b0 < 0xC2)//ĺֽڣǹ 2 ֽڱ
+					return nullptr;
+				if (b0 < 0xE0)
+				{
+					if (last - p < 2 || (p[1] & 0xC0) != 0x80)
+						return nullptr;
+					cp = ((b0 & 0x1F) << 6) | (p[1] & 0x3F);
+					return p + 2;
+				}
+				if (b0 < 0xF0)
+				{
+					if (last - p < 3)
+						return nullptr;
+					const unsigned lo = b0 == 0xE0 ? 0xA0 : 0x80, hi = b0 == 0xED ? 0x9F : 0xBF;
+					if (p[1] < lo || p[1] > hi || (p[2] & 0xC0) != 0x80)
+						return nullptr;
+					cp = ((b0 & 0x0F) << 12) | ((p[1] & 0x3F) << 6) | (p[2] & 0x3F);
+					return p + 3;
+				}
+				if (b0 < 0xF5)
+				{
+					if (last - p < 4)
+						return nullptr;
+					const unsigned lo = b0 == 0xF0 ? 0x90 : 0x80, hi = b0 == 0xF4 ? 0x8F : 0xBF;
+					if (p[1] < lo || p[1] > hi || (p[2] & 0xC0) != 0x80 || (p[3] & 0xC0) != 0x80)
+						return nullptr;
+					cp = ((b0 & 0x07) << 18) | ((p[1] & 0x3F) << 12) | ((p[2] & 0x3F) << 6) | (p[3] & 0x3F);
+					return p + 4;
+				}
+				return nullptr;
+			}
+
+			// д c֤߱Ϸ UTF-8 룬дĩβ
+			inline char *encode(char *o, char32_t c)
+			{
+				if (c < 0x80)
+					*o++ = static_cast<char>(c);
+				else if (c < 0x800)
+				{
+					*o++ = static_cast<char>(0xC0 | (c >> 6));
+					*o++ = static_cast<char>(0x80 | (c & 0x3F));
+				}
+				else if (c < 0x10000)
+				{
+					*o++ = static_cast<char>(0xE0 | (c >> 12));
+					*o++ = static_cast<char>(0x80 | ((c >> 6) & 0x3F));
+					*o++ = static_cast<char>(0x80 | (c & 0x3F));
+				}
+				else
+				{
+					*o++ = static_cast<char>(0xF0 | (c >> 18));
+					*o++ = static_cast<char>(0x80 | ((c >> 12) & 0x3F));
+					*o++ = static_cast<char>(0x80 | ((c >> 6) & 0x3F));
+					*o++ = static_cast<char>(0x80 | (c & 0x3F));
+				}
+				return o;
+			}
+
+			// ͳ [p, p+n)  flip зȽϴ t ֽڸ
+			size_t count_greater(const char *p, size_t n, signed char flip, signed char t)
+			{
+				size_t count = 0;
+#ifdef MINI_HAS_SSE2
+				const __m128i threshold = _mm_set1_epi8(t);
+				const __m128i flip_mask = _mm_set1_epi8(flip);
+				const __m128i zero = _mm_setzero_si128();
+				while (n >= 32)
+				{
+					// 8 λÿ 2127 ֮鲢һ
+					size_t rounds = n / 32 < 127 ? n / 32 : 127;
+					__m128i acc = zero;
+					for (size_t i = 0;i != rounds;++i, p += 32)
+					{
+						__m128i a = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p)), flip_mask);
+						__m128i b = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 16)), flip_mask);
+						acc = _mm_sub_epi8(acc, _mm_cmpgt_epi8(a, threshold));
+						acc = _mm_sub_epi8(acc, _mm_cmpgt_epi8(b, threshold));
+					}
+					n -= rounds * 32;
+					__m128i sum = _mm_sad_epu8(acc, zero);
+					count += static_cast<size_t>(_mm_cvtsi128_si32(sum)) + static_cast<size_t>(_mm_cvtsi128_si32(_mm_srli_si128(sum, 8)));
+				}
+#endif
+				for (;n != 0;--n, ++p)
+					count += static_cast<signed char>(*p ^ flip) > t;
+				return count;
+			}
+
+#ifdef MINI_HAS_SSE2
+			//  s ͷ 16  ASCII 뵥Ԫ
+			inline size_t ascii_run(const char16_t *s, __m128i &lo, __m128i &hi)
+			{
+				const __m128i mask = _mm_set1_epi16(static_cast<short>(0xFF80));
+				lo = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s));
+				hi = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + 8));
+				unsigned m = static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(lo, mask), _mm_setzero_si128())))
+					| static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(hi, mask), _mm_setzero_si128()))) << 16;
+				m = ~m;
+				return m == 0 ? 16 : simd::count_trailing_zeros(m) / 2;
+			}
+
+			//  s ͷ 8  ASCII 뵥Ԫ
+			inline size_t ascii_run(const char32_t *s, __m128i &lo, __m128i &hi)
+			{
+				const __m128i mask = _mm_set1_epi32(static_cast<int>(0xFFFFFF80));
+				lo = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s));
+				hi = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + 4));
+				unsigned m = static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi32(_mm_and_si128(lo, mask), _mm_setzero_si128())))
+					| static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi32(_mm_and_si128(hi, mask), _mm_setzero_si128()))) << 16;
+				m = ~m;
+				return m == 0 ? 8 : simd::count_trailing_zeros(m) / 4;
+			}
+
+			//  32  ASCII ֽչ 32 뵥Ԫ
+			inline void widen(char16_t *o, __m128i a, __m128i b)
+			{
+				const __m128i zero = _mm_setzero_si128();
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(o), _mm_unpacklo_epi8(a, zero));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(o + 8), _mm_unpackhi_epi8(a, zero));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(o + 16), _mm_unpacklo_epi8(b, zero));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(o + 24), _mm_unpackhi_epi8(b, zero));
+			}
+
+			inline void widen(char32_t *o, __m128i a, __m128i b)
+			{
+				const __m128i zero = _mm_setzero_si128();
+				const __m128i w[4] = { _mm_unpacklo_epi8(a, zero), _mm_unpackhi_epi8(a, zero),
+					_mm_unpacklo_epi8(b, zero), _mm_unpackhi_epi8(b, zero) };
+				for (int i = 0;i != 4;++i, o += 8)
+				{
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(o), _mm_unpacklo_epi16(w[i], zero));
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(o + 4), _mm_unpackhi_epi16(w[i], zero));
+				}
+			}
+#endif
+
+			/*
+			* ת [p, last) е UTF-8ÿõһһ puto ƵյλãǷʱ false
+			* ÿָʾʧܣϿյָ루ַ begin()ǺϷ
+			*/
+			template<typename CharT, typename Put>
+			bool decode_all(byte_ptr p, byte_ptr last, CharT *&o, Put put)
+			{
+				while (p != last)
+				{
+#ifdef MINI_HAS_SSE2
+					if (last - p >= 32)
+					{
+						__m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+						__m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 16));
+						unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(a)) | static_cast<unsigned>(_mm_movemask_epi8(b)) << 16;
+						if (mask == 0)
+						{
+							widen(o, a, b);
+							p += 32;
+							o += 32;
+							continue;
+						}
+						for (unsigned k = simd::count_trailing_zeros(mask);k != 0;--k)
+							*o++ = *p++;
+					}
+#endif
+					if (*p < 0x80)
+					{
+						*o++ = *p++;
+						continue;
+					}
+					char32_t cp;
+					p = decode(p, last, cp);
+					if (!p)
+						return false;
+					o = put(o, cp);
+				}
+				return true;
+			}
+
+			inline char16_t *put_utf16(char16_t *o, char32_t cp)
+			{
+				if (cp < 0x10000)
+					*o++ = static_cast<char16_t>(cp);
+				else
+				{
+					cp -= 0x10000;
+					*o++ = static_cast<char16_t>(0xD800 + (cp >> 10));
+					*o++ = static_cast<char16_t>(0xDC00 + (cp & 0x3FF));
+				}
+				return o;
+			}
+
+			inline char32_t *put_utf32(char32_t *o, char32_t cp)
+			{
+				*o++ = cp;
+				return o;
+			}
+
+			// ȡ s[i] ʼһ ASCII ַi ƵһַɶԵĴ npos
+			inline char32_t read_unit(const char16_t *s, size_t n, size_t &i)
+			{
+				char32_t c = s[i++];
+				if (c - 0xD800 >= 0x800)
+					return c;
+				if (c >= 0xDC00 || i == n || static_cast<char32_t>(s[i]) - 0xDC00 >= 0x400)
+					return static_cast<char32_t>(npos);
+				return 0x10000 + ((c - 0xD800) << 10) + (s[i++] - 0xDC00);
+			}
+
+			inline char32_t read_unit(const char32_t *s, size_t, size_t &i)
+			{
+				return s[i++];
+			}
+
+			inline bool valid_code_point(char32_t c)
+			{
+				return c <= 0x10FFFF && c - 0xD800 >= 0x800;
+			}
+
+			inline size_t encoded_length(char32_t c)
+			{
+				return c < 0x80 ? 1 : c < 0x800 ? 2 : c < 0x10000 ? 3 : 4;
+			}
+
+			// UTF-16  UTF-32 õת̣ASCII 鴦
+			template<typename CharT>
+			size_t length_from(const CharT *s, size_t n)
+			{
+				const size_t block = 32 / sizeof(CharT);
+				size_t len = 0, i = 0;
+				while (i != n)
+				{
+#ifdef MINI_HAS_SSE2
+					if (n - i >= block)
+					{
+						__m128i lo, hi;
+						size_t k = ascii_run(s + i, lo, hi);
+						len += k;
+						i += k;
+						if (k == block)
+							continue;
+					}
+#endif
+					if (s[i] < 0x80)
+					{
+						++len;
+						++i;
+						continue;
+					}
+					char32_t c = read_unit(s, n, i);
+					if (!valid_code_point(c))
+						return npos;
+					len += encoded_length(c);
+				}
+				return len;
+			}
+
+#ifdef MINI_HAS_SSE2
+			// һ ASCII 뵥Ԫѹֽ
+			inline void narrow(char *o, const char16_t *, __m128i lo, __m128i hi)
+			{
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(o), _mm_packus_epi16(lo, hi));
+			}
+
+			inline void narrow(char *o, const char32_t *, __m128i lo, __m128i hi)
+			{
+				__m128i w = _mm_packs_epi32(lo, hi);
+				_mm_storel_epi64(reinterpret_cast<__m128i*>(o), _mm_packus_epi16(w, w));
+			}
+#endif
+
+			template<typename CharT>
+			size_t convert_from(const CharT *s, size_t n, char *out)
+			{
+				const size_t block = 32 / sizeof(CharT);
+				char *o = out;
+				size_t i = 0;
+				while (i != n)
+				{
+#ifdef MINI_HAS_SSE2
+					if (n - i >= block)
+					{
+						__m128i lo, hi;
+						size_t k = ascii_run(s + i, lo, hi);
+						if (k == block)
+						{
+							narrow(o, s, lo, hi);
+							o += block;
+							i += block;
+							continue;
+						}
+						for (;k != 0;--k)
+							*o++ = static_cast<char>(s[i++]);
+					}
+#endif
+					if (s[i] < 0x80)
+					{
+						*o++ = static_cast<char>(s[i++]);
+						continue;
+					}
+					char32_t c = read_unit(s, n, i);
+					if (!valid_code_point(c))
+						return npos;
+					o = encode(o, c);
+				}
+				return static_cast<size_t>(o - out);
+			}
+
+			template<typename CharT>
+			bool append_from(string &out, const CharT *s, size_t n)
+			{
+				size_t len = length_from(s, n);
+				if (len == npos)
+					return false;
+				size_t old = out.size();
+				out.append(len, '\0');
+				convert_from(s, n, out.begin() + old);
+				return true;
+			}
+
+			inline size_t decoded_length(string_view s, char16_t*) { return utf16_length(s); }
+			inline size_t decoded_length(string_view s, char32_t*) { return utf32_length(s); }
+			inline size_t decode_to(string_view s, char16_t *out) { return to_utf16(s, out); }
+			inline size_t decode_to(string_view s, char32_t *out) { return to_utf32(s, out); }
+
+			// ȰϷĳչ outתʧʱٽص
+			template<typename CharT>
+			bool append_to(basic_string<CharT> &out, string_view s)
+			{
+				if (s.empty())
+					return true;
+				size_t old = out.size();
+				out.append(decoded_length(s, static_cast<CharT*>(nullptr)), CharT());
+				if (decode_to(s, out.begin() + old) == npos)
+				{
+					out.erase(out.begin() + old, out.end());
+					return false;
+				}
+				return true;
+			}
+		}
+
+		size_t invalid_offset(string_view s)
+		{
+			byte_ptr first = reinterpret_cast<byte_ptr>(s.data()), last = first + s.size();
+			byte_ptr p = first;
+			while (p != last)
+			{
+				p = reinterpret_cast<byte_ptr>(simd::skip_ascii(reinterpret_cast<const char*>(p), reinterpret_cast<const char*>(last)));
+				// Ķַֽ룬ص ASCII  SIMD
+				while (p != last && *p >= 0x80)
+				{
+					char32_t cp;
+					byte_ptr next = decode(p, last, cp);
+					if (!next)
+						return static_cast<size_t>(p - first);
+					p = next;
+				}
+			}
+			return npos;
+		}
+
+		size_t count_code_points(string_view s)
+		{
+			// ֽڣ0x80~0xBFз -128~-65ÿֽڿʼһ
+			return count_greater(s.data(), s.size(), 0, -65);
+		}
+
+		size_t utf16_length(string_view s)
+		{
+			// 4 ַֽֽ >= 0xF0תλ >= 0x70 UTF-16 ռ뵥Ԫ
+			return count_greater(s.data(), s.size(), 0, -65) + count_greater(s.data(), s.size(), -128, 0x6F);
+		}
+
+		size_t to_utf16(string_view s, char16_t *out)
+		{
+			byte_ptr p = reinterpret_cast<byte_ptr>(s.data());
+			char16_t *o = out;
+			if (!decode_all(p, p + s.size(), o, put_utf16))
+				return npos;
+			return static_cast<size_t>(o - out);
+		}
+
+		size_t to_utf32(string_view s, char32_t *out)
+		{
+			byte_ptr p = reinterpret_cast<byte_ptr>(s.data());
+			char32_t *o = out;
+			if (!decode_all(p, p + s.size(), o, put_utf32))
+				return npos;
+			return static_cast<size_t>(o - out);
+		}
+
+		size_t length_from_utf16(const char16_t *s, size_t n)
+		{
+			return length_from(s, n);
+		}
+
+		size_t length_from_utf32(const char32_t *s, size_t n)
+		{
+			return length_from(s, n);
+		}
+
+		size_t from_utf16(const char16_t *s, size_t n, char *out)
+		{
+			return convert_from(s, n, out);
+		}
+
+		size_t from_utf32(const char32_t *s, size_t n, char *out)
+		{
+			return convert_from(s, n, out);
+		}
+
+		bool append_from_utf16(string &out, const char16_t *s, size_t n)
+		{
+			return append_from(out, s, n);
+		}
+
+		bool append_from_utf32(string &out, const char32_t *s, size_t n)
+		{
+			return append_from(out, s, n);
+		}
+
+		bool append_to_utf16(u16string &out, string_view s)
+		{
+			return append_to(out, s);
+		}
+
+		bool append_to_utf32(u32string &out, string_view s)
+		{
+			return append_to(out, s);
+		}
+	}
+}
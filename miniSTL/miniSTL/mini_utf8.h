@@ -0,0 +1,59 @@
+#ifndef _UTF8_H
+#define _UTF8_H
+
+#include "mini_string.h"
+#include "mini_string_view.h"
+
+#include <cstddef>
+
+namespace miniSTL
+{
+	/*
+	* UTF-8 У顢Լ UTF-16/UTF-32 ֮ת
+	* У Unicode ׼һ£ܾ롢㣨U+D800~U+DFFFͳ U+10FFFF 
+	* к ASCII ֶ SIMD ·һδ 32~64 ֽڣַֽ
+	* תɵṩ賤ȿ utf16_length() Ⱥ
+	*/
+	namespace utf8
+	{
+		static const size_t npos = static_cast<size_t>(-1);
+
+		// صһǷеʼƫƣϷʱ npos
+		size_t invalid_offset(string_view s);
+
+		inline bool validate(string_view s)
+		{
+			return invalid_offset(s) == npos;
+		}
+
+		// ٶ s ǺϷ UTF-8
+		size_t count_code_points(string_view s);
+		size_t utf16_length(string_view s);
+		inline size_t utf32_length(string_view s)
+		{
+			return count_code_points(s);
+		}
+
+		// д out Ĵ뵥Ԫs Ϸʱ npos
+		size_t to_utf16(string_view s, char16_t *out);
+		size_t to_utf32(string_view s, char32_t *out);
+
+		// ת UTF-8 ֽвɶԵĴǷʱ npos
+		size_t length_from_utf16(const char16_t *s, size_t n);
+		size_t length_from_utf32(const char32_t *s, size_t n);
+
+		// д out ֽ벻Ϸʱ npos
+		size_t from_utf16(const char16_t *s, size_t n, char *out);
+		size_t from_utf32(const char32_t *s, size_t n, char *out);
+
+		// ת׷ӵ out ĩβ벻Ϸʱ out 䲢 false
+		bool append_from_utf16(string &out, const char16_t *s, size_t n);
+		bool append_from_utf32(string &out, const char32_t *s, size_t n);
+
+		//  UTF-8  s ת׷ӵ out ĩβs Ϸʱ out 䲢 false
+		bool append_to_utf16(u16string &out, string_view s);
+		bool append_to_utf32(u32string &out, string_view s);
+	}
+}
+
+#endif
@@ -30,7 +30,8 @@ namespace miniSTL
 		template <typename U,typename V>
 		pair(const pair<U, V> &pr);
 		pair(const first_type &a, const second_type &b);
-		pair& operator=(const pair &pr);
+		// ʹĬϵĸֵԱƽʱ pair Ҳƽƣcopy 㷨ֱ memmove
+		pair& operator=(const pair &pr) = default;
 		void swap(pair &pr);
 
 	public:
@@ -63,16 +64,6 @@ namespace miniSTL
 	template <typename T1,typename T2>
 	pair<T1,T2>::pair(const first_type &a,const second_type &b):first(a),second(b){}
 
-	template <typename T1,typename T2>
-	pair<T1, T2>& pair<T1, T2>::operator=(const pair<T1, T2> &pr)
-	{
-		if (this != &pr)
-		{
-			first = pr.first;
-			second = pr.second;
-		}
-	}
-
 	template <typename T1,typename T2>
 	void pair<T1, T2>::swap(pair<T1, T2> &pr)
 	{
@@ -143,6 +143,12 @@ namespace miniSTL
 
 	private:
 		void destroy_and_deallocate_all();
+		// ԪؿֽڱȽʱֱӽ memcmp
+		bool equal_aux(const vector &v, _true_type) const
+		{
+			return empty() || memcmp(_start, v._start, sizeof(T) * size()) == 0;
+		}
+		bool equal_aux(const vector &v, _false_type) const;
 		iterator allocate_and_fill_n(const size_type n, const value_type &value)
 		{
 			iterator result = data_allocator::allocate(n);
@@ -151,11 +157,23 @@ namespace miniSTL
 		}
 
 	public:
-		template <typename T,typename Alloc>
-		friend bool operator==(const vector<T, Alloc> &v1, const vector<T, Alloc> &v2);
+		template <typename U,typename A>
+		friend bool operator==(const vector<U, A> &v1, const vector<U, A> &v2);
 		
-		template <typename T,typename Alloc>
-		friend bool operator!=(const vector<T, Alloc> &v1, const vector<T, Alloc> &v2);
+		template <typename U,typename A>
+		friend bool operator!=(const vector<U, A> &v1, const vector<U, A> &v2);
+
+		template <typename U,typename A>
+		friend bool operator<(const vector<U, A> &v1, const vector<U, A> &v2);
+
+		template <typename U,typename A>
+		friend bool operator<=(const vector<U, A> &v1, const vector<U, A> &v2);
+
+		template <typename U,typename A>
+		friend bool operator>(const vector<U, A> &v1, const vector<U, A> &v2);
+
+		template <typename U,typename A>
+		friend bool operator>=(const vector<U, A> &v1, const vector<U, A> &v2);
 
 	};
 }
@@ -208,20 +226,22 @@ namespace miniSTL
 	bool vector<T, Alloc>::operator==(const vector &v) const
 	{
 		if (size() != v.size())
-		{
 			return false;
-		}
-		else
+		typedef typename _is_bitwise_comparable<T>::type is_bitwise;
+		return equal_aux(v, is_bitwise());
+	}
+
+	template <typename T,typename Alloc>
+	bool vector<T, Alloc>::equal_aux(const vector &v, _false_type) const
+	{
+		auto ptr1 = _start;
+		auto ptr2 = v._start;
+		for (;ptr1 != _finish && ptr2 != v._finish;++ptr1, ++ptr2)
 		{
-			auto ptr1 = _start;
-			auto ptr2 = v._start;
-			for (;ptr1 != _finish && ptr2 != v._finish;++ptr1, ++ptr2)
-			{
-				if (*ptr1 != *ptr2)
-					return false;
-			}
-			return true;
+			if (*ptr1 != *ptr2)
+				return false;
 		}
+		return true;
 	}
 
 	template <typename T,typename Alloc>
@@ -242,6 +262,30 @@ namespace miniSTL
 		return !(v1 == v2);
 	}
 
+	template <typename T,typename Alloc>
+	bool operator<(const vector<T, Alloc> &v1, const vector<T, Alloc> &v2)
+	{
+		return miniSTL::lexicographical_compare(v1.begin(), v1.end(), v2.begin(), v2.end());
+	}
+
+	template <typename T,typename Alloc>
+	bool operator<=(const vector<T, Alloc> &v1, const vector<T, Alloc> &v2)
+	{
+		return !(v2 < v1);
+	}
+
+	template <typename T,typename Alloc>
+	bool operator>(const vector<T, Alloc> &v1, const vector<T, Alloc> &v2)
+	{
+		return v2 < v1;
+	}
+
+	template <typename T,typename Alloc>
+	bool operator>=(const vector<T, Alloc> &v1, const vector<T, Alloc> &v2)
+	{
+		return !(v1 < v2);
+	}
+
 	template <typename T,typename Alloc>
 	void vector<T, Alloc>::shrink_to_fit()
 	{
@@ -334,7 +378,7 @@ namespace miniSTL
 	template <typename T,typename Alloc>
 	typename vector<T, Alloc>::iterator vector<T, Alloc>::erase(iterator first, iterator last)
 	{
-		iterator i = copy(last, _finish, first);
+		iterator i = miniSTL::copy(last, _finish, first);
 		globals::destroy(i, _finish);
 		_finish = _finish - (last - first);
 		return first;
@@ -346,7 +390,7 @@ namespace miniSTL
 		vector<T, Alloc>::erase(iterator position)
 	{
 		if (position + 1 != end())
-			copy(position + 1, _finish, position);
+			miniSTL::copy(position + 1, _finish, position);
 		--_finish;
 		globals::destroy(_finish);
 		return position;